@@ -6,7 +6,10 @@
  */
 
 #include "DependencyControlCenter.h"
+#include <algorithm>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <thread>
 #include <utility>
 #include <grpcpp/grpcpp.h>
@@ -15,7 +18,10 @@
 #include <sstream>
 #include <llvm/IR/IntrinsicInst.h>
 #include <llvm/IR/InlineAsm.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/xxhash.h>
 #include "general.h"
+#include "../DMM/DSnapshot.h"
 
 namespace dra {
 
@@ -29,6 +35,8 @@ namespace dra {
                                        const std::string &bit_code, const std::string &config,
                                        const std::string &port_address) {
 
+        this->obj_dump = obj_dump;
+        this->bit_code = bit_code;
         DM.initializeModule(obj_dump, assembly, bit_code);
         dra::outputTime("initializeModule");
         dra::outputTime("NumberBasicBlock : " + std::to_string(this->DM.Modules->NumberBasicBlock));
@@ -37,18 +45,21 @@ namespace dra {
         std::ifstream config_json_ifstream(config);
         config_json_ifstream >> this->config_json;
 
-        //Deserialize the static analysis results.
         for (const auto &dev : this->config_json.items()) {
-            std::string staticRes;
-            staticRes.assign(dev.value()["file_taint"]);
-            dra::outputTime("staticRes : " + staticRes);
+            Device &d = this->devices[dev.key()];
+            d.name = dev.key();
+            d.file_taint.assign(dev.value()["file_taint"]);
+            dra::outputTime("staticRes : " + d.file_taint);
             for (const auto &p : dev.value()["path_s"].items()) {
                 std::string t = p.value();
                 dra::outputTime("path : " + t);
             }
-            auto sar = new sta::StaticAnalysisResult();
-            this->STA_map[dev.key()] = sar;
-            sar->initStaticRes(staticRes, &this->DM);
+        }
+        this->build_device_route();
+        this->build_file_operations();
+        //Deserialize the static analysis results, otherwise on first use.
+        if (!this->lazySTA) {
+            this->load_devices();
         }
 
         if (!port_address.empty()) {
@@ -58,22 +69,17 @@ namespace dra {
     }
 
     void DependencyControlCenter::run() {
+        if (this->run_stream()) {
+            return;
+        }
+        dra::outputTime("the manager has no StreamNewInput, poll GetNewInput");
         for (;;) {
 #if !DEBUG
             dra::outputTime("wait for get newInput");
 #endif
             Inputs *newInput = client->GetNewInput();
             if (newInput != nullptr) {
-                for (auto &input : *newInput->mutable_input()) {
-//                    std::cout << "new input : " << input.sig() << std::endl;
-//                    std::cout << input.program() << std::endl;
-#if !DEBUG
-                    dra::outputTime("new input : " + input.sig());
-                    dra::outputTime(input.program());
-#endif
-                    DInput *dInput = DM.getInput(&input);
-                    check_input(dInput);
-                }
+                this->check_inputs(newInput);
                 newInput->Clear();
                 delete newInput;
 #if !DEBUG
@@ -99,6 +105,172 @@ namespace dra {
         }
     }
 
+    bool DependencyControlCenter::run_stream() {
+        for (;;) {
+            //the inputs pushed by the stream, a full queue holds the stream back until the pipeline catches up
+            BoundedQueue<Inputs *> received(this->queueDepth);
+            std::atomic<bool> poll_condition(false);
+            std::thread pipeline([&] { this->run_pipeline(received, poll_condition); });
+
+            //the conditions pushed by the other stream
+            std::deque<Conditions *> events;
+            std::mutex eventLock;
+            std::condition_variable eventReady;
+            uint32_t running = 2;
+            grpc::ClientContext context[2];
+            grpc::Status status[2];
+
+            auto done = [&](uint32_t i, const grpc::Status &s) {
+                std::lock_guard<std::mutex> lock(eventLock);
+                status[i] = s;
+                running--;
+                eventReady.notify_one();
+            };
+            std::thread readers[2] = {
+                    std::thread([&] {
+                        done(0, client->StreamNewInput(&context[0], [&](Inputs *inputs) {
+                            if (!received.push(inputs)) {
+                                delete inputs;
+                            }
+                        }));
+                    }),
+                    std::thread([&] {
+                        done(1, client->StreamCondition(&context[1], [&](Conditions *conditions) {
+                            std::lock_guard<std::mutex> lock(eventLock);
+                            events.push_back(conditions);
+                            eventReady.notify_one();
+                        }));
+                    }),
+            };
+#if !DEBUG
+            dra::outputTime("wait for the stream of newInput");
+#endif
+
+            //the streams that ended and were seen by this loop
+            uint32_t ended = 0;
+            std::unique_lock<std::mutex> lock(eventLock);
+            for (;;) {
+                eventReady.wait(lock, [&] { return !events.empty() || 2 - running > ended; });
+                if (!events.empty()) {
+                    auto conditions = events.front();
+                    events.pop_front();
+                    lock.unlock();
+                    this->check_condition(conditions);
+                    delete conditions;
+                    lock.lock();
+                    continue;
+                }
+                ended = 2 - running;
+                if (running == 0) {
+                    break;
+                }
+                //a manager without StreamCondition still streams the inputs, poll the conditions after them as before
+                if (status[1].error_code() == grpc::StatusCode::UNIMPLEMENTED && !poll_condition) {
+                    poll_condition = true;
+                    continue;
+                }
+                context[0].TryCancel();
+                context[1].TryCancel();
+            }
+            lock.unlock();
+            readers[0].join();
+            readers[1].join();
+            //finish the inputs received so far
+            received.close();
+            pipeline.join();
+
+            if (status[0].error_code() == grpc::StatusCode::UNIMPLEMENTED) {
+                return false;
+            }
+            std::cerr << "stream of newInput ends " << status[0].error_code() << ": " << status[0].error_message()
+                      << std::endl;
+            //the same exit as the poll of GetNewInput
+            if (client->Check() == nullptr) {
+                return true;
+            }
+            dra::outputTime("sleep_for 60s");
+            std::this_thread::sleep_for(std::chrono::seconds(60));
+            setRPCConnection(this->port);
+        }
+    }
+
+    void DependencyControlCenter::run_pipeline(BoundedQueue<Inputs *> &received,
+                                               const std::atomic<bool> &poll_condition) {
+        uint32_t workers = this->numberWorker;
+        if (workers == 0) {
+            workers = dra::number_thread();
+        }
+        //the workers share the threads of the module for their batches of queries
+        this->queryThread = std::max<uint32_t>(1, this->DM.Modules->NumberThread / workers);
+
+        BoundedQueue<InputJob *> prepared(this->queueDepth);
+        BoundedQueue<InputJob *> analyzed(this->queueDepth);
+        std::vector<std::thread> analyzers;
+        for (uint32_t t = 0; t < workers; t++) {
+            analyzers.emplace_back([&] {
+                InputJob *job;
+                while (prepared.pop(job)) {
+                    this->analyze_input(job);
+                    analyzed.push(job);
+                }
+            });
+        }
+        //one stream of dependencies at a time
+        std::thread uploader([&] {
+            InputJob *job;
+            while (analyzed.pop(job)) {
+                this->send_input(job);
+            }
+        });
+
+        //The coverage is ingested in the order the inputs arrive, the analysis of an input sees at least its own.
+        Inputs *inputs;
+        while (received.pop(inputs)) {
+            for (auto &input : *inputs->mutable_input()) {
+#if !DEBUG
+                dra::outputTime("new input : " + input.sig());
+                dra::outputTime(input.program());
+#endif
+                InputJob *job;
+                {
+                    std::lock_guard<std::mutex> guard(this->dataLock);
+                    job = this->prepare_input(this->DM.getInput(&input));
+                }
+                prepared.push(job);
+            }
+            delete inputs;
+            if (poll_condition) {
+                this->check_condition();
+            }
+            this->send_number_basicblock_covered();
+        }
+
+        prepared.close();
+        for (auto &a : analyzers) {
+            a.join();
+        }
+        analyzed.close();
+        uploader.join();
+        this->queryThread = 0;
+    }
+
+    void DependencyControlCenter::check_inputs(Inputs *newInput) {
+        for (auto &input : *newInput->mutable_input()) {
+//            std::cout << "new input : " << input.sig() << std::endl;
+//            std::cout << input.program() << std::endl;
+#if !DEBUG
+            dra::outputTime("new input : " + input.sig());
+            dra::outputTime(input.program());
+#endif
+            DInput *dInput;
+            {
+                std::lock_guard<std::mutex> guard(this->dataLock);
+                dInput = DM.getInput(&input);
+            }
+            check_input(dInput);
+        }
+    }
+
     void DependencyControlCenter::setRPCConnection(const std::string &grpc_port) {
         this->client = new dra::DependencyRPCClient(
                 grpc::CreateChannel(port, grpc::InsecureChannelCredentials()));
@@ -108,102 +280,189 @@ namespace dra {
         dra::outputTime("GetVmOffsets");
     }
 
-    void DependencyControlCenter::check_input(DInput *dInput) {
-#if DEBUG
-        std::cout << "dUncoveredAddress size : " << std::dec << dInput->dUncoveredAddress.size()
-                  << std::endl;
-#endif
+    void DependencyControlCenter::setSnapshot(bool snapshot) {
+        this->DM.useSnapshot = snapshot;
+    }
 
-        u_int32_t number_conditions = dInput->dConditionAddress.size();
-        u_int32_t number_conditions_dependency = 0;
-        for (auto c : dInput->dConditionAddress) {
-            if (get_write_basicblock(c) != nullptr) {
-                number_conditions_dependency++;
-            }
-        }
-#if DEBUG
-        std::cout << "number_conditions : " << std::dec << number_conditions << std::endl;
-        std::cout << "number_conditions_dependency : " << std::dec << number_conditions_dependency << std::endl;
-#endif
+    void DependencyControlCenter::setLazy(bool lazy) {
+        this->DM.Modules->Lazy = lazy;
+    }
 
+    void DependencyControlCenter::setLazySTA(bool lazy, uint32_t max_loaded) {
+        this->lazySTA = lazy;
+        this->maxLoadedSTA = max_loaded;
+    }
 
-        uint64_t i = 0;
+    void DependencyControlCenter::setPipeline(uint32_t workers, uint32_t depth) {
+        this->numberWorker = workers;
+        this->queueDepth = depth;
+    }
+
+    DependencyControlCenter::InputJob *DependencyControlCenter::prepare_input(DInput *dInput) {
+        auto *job = new InputJob();
+        job->sig = dInput->sig;
+        job->program = dInput->program;
+        job->conditions.assign(dInput->dConditionAddress.begin(), dInput->dConditionAddress.end());
+        job->uncovered.reserve(dInput->dUncoveredAddress.size());
         for (auto u : dInput->dUncoveredAddress) {
-            i++;
+            job->uncovered.push_back(*u);
+        }
+        return job;
+    }
+
+    void DependencyControlCenter::check_input(DInput *dInput) {
+        InputJob *job;
+        {
+            std::lock_guard<std::mutex> guard(this->dataLock);
+            job = this->prepare_input(dInput);
+        }
+        this->analyze_input(job);
+        this->send_input(job);
+    }
+
+    void DependencyControlCenter::analyze_input(InputJob *job) {
 #if DEBUG
-            dra::outputTime("uncovered address count : " + std::to_string(i));
+        std::cout << "dUncoveredAddress size : " << std::dec << job->uncovered.size()
+                  << std::endl;
 #endif
 
-            if (this->DM.check_uncovered_address(u)) {
+        std::vector<std::pair<u_int64_t, u_int32_t>> queries;
+        for (auto c : job->conditions) {
+            queries.emplace_back(c, 0);
+        }
+        for (auto &u : job->uncovered) {
+            queries.emplace_back(u.condition_address(), get_branch_index(&u));
+        }
+        std::vector<Device *> pinned = this->prefetch_write_basicblock(queries);
 
-                auto *dependency = new Dependency();
+        //Look up DM and the cached results under dataLock, the results are kept while the devices are in use,
+        //then build the dependencies without it.
+        u_int32_t number_conditions = job->conditions.size();
+        u_int32_t number_conditions_dependency = 0;
+        std::vector<UncoveredDependency> resolved;
+        {
+            std::lock_guard<std::mutex> guard(this->dataLock);
+            for (auto c : job->conditions) {
+                if (get_write_basicblock(c) != nullptr) {
+                    number_conditions_dependency++;
+                }
+            }
 
-                unsigned long long int syzkallerConditionAddress = DM.getSyzkallerAddress(u->condition_address());
-                unsigned long long int syzkallerUncoveredAddress = DM.getSyzkallerAddress(u->uncovered_address());
+            for (auto &uncovered : job->uncovered) {
+                Condition *u = &uncovered;
+                if (!this->DM.check_uncovered_address(u)) {
+                    continue;
+                }
+                resolved.emplace_back();
+                UncoveredDependency &r = resolved.back();
+                r.uncovered = u;
+                r.condition_address = DM.getSyzkallerAddress(u->condition_address());
+                r.uncovered_address = DM.getSyzkallerAddress(u->uncovered_address());
 #if DEBUG
                 outputTime("");
                 std::cout << "condition trace_pc_address : " << std::hex << u->condition_address() << "\n";
                 std::cout << "uncovered trace_pc_address : " << std::hex << u->uncovered_address() << "\n";
-                std::cout << "condition getSyzkallerAddress : " << std::hex << syzkallerConditionAddress << "\n";
-                std::cout << "uncovered getSyzkallerAddress : " << std::hex << syzkallerUncoveredAddress << "\n";
+                std::cout << "condition getSyzkallerAddress : " << std::hex << r.condition_address << "\n";
+                std::cout << "uncovered getSyzkallerAddress : " << std::hex << r.uncovered_address << "\n";
 #endif
-                UncoveredAddress *uncoveredAddress = dependency->mutable_uncovered_address();
-                uncoveredAddress->set_condition_address(syzkallerConditionAddress);
-                uncoveredAddress->set_uncovered_address(syzkallerUncoveredAddress);
                 for (auto a : u->right_branch_address()) {
-                    uncoveredAddress->add_right_branch_address(DM.getSyzkallerAddress(a));
+                    r.right_branch_address.push_back(DM.getSyzkallerAddress(a));
                 }
 
-                if (this->DM.Address2BB.find(u->uncovered_address()) != this->DM.Address2BB.end()) {
-                    DBasicBlock *db = DM.Address2BB[u->uncovered_address()]->parent;
+                DBasicBlock *db = DM.get_DB_from_address(u->uncovered_address());
+                if (db != nullptr) {
                     //                    std::set<llvm::BasicBlock *> bbs;
                     //                    this->STA._get_all_successors(db->basicBlock, bbs);
                     //                    uint32_t bbcount = bbs.size();
                     std::map<std::string, dra::DBasicBlock *> temp;
-                    uncoveredAddress->set_number_arrive_basicblocks(db->get_arrive_uncovered_instructions(temp));
-                    uncoveredAddress->set_number_dominator_instructions(
-                            db->get_all_dominator_uncovered_instructions(temp));
+                    r.basicblock = true;
+                    r.number_arrive_basicblocks = db->get_arrive_uncovered_instructions(temp);
+                    r.number_dominator_instructions = db->get_all_dominator_uncovered_instructions(temp);
                 }
 
-                Input *input = dependency->mutable_input();
-                input->set_sig(dInput->sig);
-                input->set_program(dInput->program);
-                input->set_number_conditions(number_conditions);
-                input->set_number_conditions_dependency(number_conditions_dependency);
-                (*input->mutable_uncovered_address())[syzkallerUncoveredAddress] = u->idx();
+                r.write_basicblock = this->get_write_basicblock(u);
+                if (r.write_basicblock != nullptr) {
+                    r.write.resize(r.write_basicblock->size());
+                    uint64_t j = 0;
+                    for (auto &x : *r.write_basicblock) {
+                        this->resolve_write_basicblock(x, &r.write[j++]);
+                    }
+                }
+            }
+        }
+#if DEBUG
+        std::cout << "number_conditions : " << std::dec << number_conditions << std::endl;
+        std::cout << "number_conditions_dependency : " << std::dec << number_conditions_dependency << std::endl;
+#endif
 
-                sta::MODS *write_basicblock = this->get_write_basicblock(u);
-                if (write_basicblock == nullptr) {
-                    uncoveredAddress->set_kind(UncoveredAddressKind::UncoveredAddressInputRelated);
-                } else if (write_basicblock->empty()) {
-                    uncoveredAddress->set_kind(UncoveredAddressKind::UncoveredAddressDependencyRelated);
-                } else if (!write_basicblock->empty()) {
-                    uncoveredAddress->set_kind(UncoveredAddressKind::UncoveredAddressDependencyRelated);
 
-                    (*uncoveredAddress->mutable_input())[dInput->sig] = u->idx();
+        uint64_t i = 0;
+        for (auto &r : resolved) {
+            Condition *u = r.uncovered;
+            i++;
+#if DEBUG
+            dra::outputTime("uncovered address count : " + std::to_string(i));
+#endif
 
-                    set_runtime_data(uncoveredAddress->mutable_run_time_date(), input->program(), u->idx(),
-                                     syzkallerConditionAddress, syzkallerUncoveredAddress);
+            auto *dependency = new Dependency();
 
-                    for (auto &x : *write_basicblock) {
-                        WriteAddress *writeAddress = dependency->add_write_address();
-                        write_basic_block_to_address(x, u, writeAddress);
-                        auto *waa = new writeAddressAttributes();
-                        write_basic_block_to_adttributes(x, waa);
-                        (*uncoveredAddress->mutable_write_address())[waa->write_address()] = *waa;
-                        (*writeAddress->mutable_uncovered_address())[syzkallerUncoveredAddress] = *waa;
-                        set_runtime_data(writeAddress->mutable_run_time_date(), input->program(), u->idx(),
-                                         syzkallerConditionAddress, syzkallerUncoveredAddress);
-                    }
+            unsigned long long int syzkallerConditionAddress = r.condition_address;
+            unsigned long long int syzkallerUncoveredAddress = r.uncovered_address;
+            UncoveredAddress *uncoveredAddress = dependency->mutable_uncovered_address();
+            uncoveredAddress->set_condition_address(syzkallerConditionAddress);
+            uncoveredAddress->set_uncovered_address(syzkallerUncoveredAddress);
+            for (auto a : r.right_branch_address) {
+                uncoveredAddress->add_right_branch_address(a);
+            }
+
+            if (r.basicblock) {
+                uncoveredAddress->set_number_arrive_basicblocks(r.number_arrive_basicblocks);
+                uncoveredAddress->set_number_dominator_instructions(r.number_dominator_instructions);
+            }
+
+            Input *input = dependency->mutable_input();
+            input->set_sig(job->sig);
+            input->set_program(job->program);
+            input->set_number_conditions(number_conditions);
+            input->set_number_conditions_dependency(number_conditions_dependency);
+            (*input->mutable_uncovered_address())[syzkallerUncoveredAddress] = u->idx();
+
+            sta::MODS *write_basicblock = r.write_basicblock;
+            if (write_basicblock == nullptr) {
+                uncoveredAddress->set_kind(UncoveredAddressKind::UncoveredAddressInputRelated);
+            } else if (write_basicblock->empty()) {
+                uncoveredAddress->set_kind(UncoveredAddressKind::UncoveredAddressDependencyRelated);
+            } else if (!write_basicblock->empty()) {
+                uncoveredAddress->set_kind(UncoveredAddressKind::UncoveredAddressDependencyRelated);
+
+                (*uncoveredAddress->mutable_input())[job->sig] = u->idx();
 
+                set_runtime_data(uncoveredAddress->mutable_run_time_date(), input->program(), u->idx(),
+                                 syzkallerConditionAddress, syzkallerUncoveredAddress);
+
+                for (auto &x : r.write) {
+                    WriteAddress *writeAddress = dependency->add_write_address();
+                    write_basic_block_to_address(x, writeAddress);
+                    auto *waa = new writeAddressAttributes();
+                    write_basic_block_to_adttributes(x, waa);
+                    (*uncoveredAddress->mutable_write_address())[waa->write_address()] = *waa;
+                    (*writeAddress->mutable_uncovered_address())[syzkallerUncoveredAddress] = *waa;
+                    set_runtime_data(writeAddress->mutable_run_time_date(), input->program(), u->idx(),
+                                     syzkallerConditionAddress, syzkallerUncoveredAddress);
                 }
-                this->send_dependency(dependency);
-                dependency->Clear();
-                delete dependency;
-            } else {
 
             }
+            job->dependencies.push_back(dependency);
         }
+        this->release_devices(pinned);
+    }
+
+    void DependencyControlCenter::send_input(InputJob *job) {
+        for (auto dependency : job->dependencies) {
+            this->send_dependency(dependency);
+        }
+        this->client->FlushDependencies();
+        delete job;
     }
 
     void DependencyControlCenter::send_dependency(Dependency *dependency) {
@@ -218,12 +477,106 @@ namespace dra {
             }
             std::cout << "dependency size : " << dependency->ByteSizeLong() << std::endl;
 #endif
-            if (dependency->ByteSizeLong() < 0x7fffffff) {
-                auto replay = client->SendDependency(*dependency);
-                delete replay;
-            } else {
-                std::cout << "dependency is too big : " << dependency->ByteSizeLong() << std::endl;
+            size_t total = dependency->ByteSizeLong();
+            if (total < DEPENDENCY_CHUNK_BYTES) {
+                client->AddDependency(dependency);
+                return;
             }
+
+            //split a big one by its write addresses, the input goes with the first chunk and every chunk has
+            //the uncovered address with the attributes of its own write addresses, the manager merges them back
+#if DEBUG_RPC
+            std::cout << "dependency is split : " << total << std::endl;
+#endif
+            UncoveredAddress *uncoveredAddress = dependency->mutable_uncovered_address();
+            google::protobuf::Map<uint32_t, writeAddressAttributes> attributes;
+            attributes.swap(*uncoveredAddress->mutable_write_address());
+            std::vector<Dependency *> chunks;
+            uint64_t bytes = 0;
+            //the chunk with room for size more bytes
+            auto chunk_for = [&](uint64_t size) -> Dependency * {
+                if (!chunks.empty() && bytes + size < DEPENDENCY_CHUNK_BYTES) {
+                    bytes += size;
+                    return chunks.back();
+                }
+                auto *chunk = new Dependency();
+                if (dependency->has_input()) {
+                    chunk->mutable_input()->Swap(dependency->mutable_input());
+                    dependency->clear_input();
+                }
+                *chunk->mutable_uncovered_address() = *uncoveredAddress;
+                chunks.push_back(chunk);
+                bytes = chunk->ByteSizeLong() + size;
+                return chunk;
+            };
+            for (auto &wa : *dependency->mutable_write_address()) {
+                uint64_t size = wa.ByteSizeLong();
+                auto a = attributes.find(wa.write_address());
+                uint64_t size_attributes = a != attributes.end() ? a->second.ByteSizeLong() : 0;
+                if (size + size_attributes < DEPENDENCY_CHUNK_BYTES) {
+                    Dependency *chunk = chunk_for(size + size_attributes);
+                    if (a != attributes.end()) {
+                        (*chunk->mutable_uncovered_address()->mutable_write_address())[a->first] = a->second;
+                    }
+                    chunk->add_write_address()->Swap(&wa);
+                    continue;
+                }
+
+                //a big write address goes in pieces with some of the entries of its maps each, the first one with
+                //its attributes and its runtime data, the manager merges the pieces of a write address back
+                Dependency *last = nullptr;
+                WriteAddress *piece = nullptr;
+                auto piece_for = [&](uint64_t size) -> WriteAddress * {
+                    Dependency *chunk = chunk_for(size);
+                    if (chunk != last) {
+                        last = chunk;
+                        piece = chunk->add_write_address();
+                        piece->set_write_address(wa.write_address());
+                        piece->set_kind(wa.kind());
+                    }
+                    return piece;
+                };
+                piece_for(wa.run_time_date().ByteSizeLong() + size_attributes)->mutable_run_time_date()->Swap(
+                        wa.mutable_run_time_date());
+                if (a != attributes.end()) {
+                    (*last->mutable_uncovered_address()->mutable_write_address())[a->first] = a->second;
+                }
+                for (auto &x : wa.uncovered_address()) {
+                    WriteAddress *p = piece_for(DEPENDENCY_ENTRY_BYTES + x.second.ByteSizeLong());
+                    (*p->mutable_uncovered_address())[x.first] = x.second;
+                }
+                for (auto &x : wa.file_operations_function()) {
+                    WriteAddress *p = piece_for(DEPENDENCY_ENTRY_BYTES + x.first.size());
+                    (*p->mutable_file_operations_function())[x.first] = x.second;
+                }
+                for (auto &x : wa.input()) {
+                    WriteAddress *p = piece_for(DEPENDENCY_ENTRY_BYTES + x.first.size());
+                    (*p->mutable_input())[x.first] = x.second;
+                }
+            }
+
+            //only a single entry or the input itself can still be too big for protobuf, then the manager is told
+            //instead of losing the dependency without a word
+            for (auto chunk : chunks) {
+                size_t size = chunk->ByteSizeLong();
+                if (size >= 0x7fffffff) {
+                    std::stringstream log;
+                    log << "dependency is too big : uncovered address " << std::hex
+                        << uncoveredAddress->uncovered_address() << std::dec << " chunk " << size << " of " << total
+                        << " bytes, dropped\n";
+                    std::cerr << log.str();
+                    client->SendLog(log.str());
+                    for (auto c : chunks) {
+                        delete c;
+                    }
+                    delete dependency;
+                    return;
+                }
+            }
+            for (auto chunk : chunks) {
+                client->AddDependency(chunk);
+            }
+            delete dependency;
         } else {
         }
     }
@@ -241,40 +594,43 @@ namespace dra {
         r->mutable_right_branch_address();
     }
 
-    void DependencyControlCenter::write_basic_block_to_address(sta::Mod *write_basicblock, Condition *condition,
-                                                               WriteAddress *writeAddress) {
+    void DependencyControlCenter::write_basic_block_to_address(sta::Mod *write_basicblock, WriteAddress *writeAddress) {
+        WriteBasicBlock w;
+        this->resolve_write_basicblock(write_basicblock, &w);
+        this->write_basic_block_to_address(w, writeAddress);
+    }
 
+    void DependencyControlCenter::resolve_write_basicblock(sta::Mod *write_basicblock, WriteBasicBlock *w) {
         DBasicBlock *db = this->DM.get_DB_from_bb(write_basicblock->B);
-        unsigned int write_address = DM.getSyzkallerAddress(db->trace_pc_address);
+        w->mod = write_basicblock;
+        w->write_address = DM.getSyzkallerAddress(db->trace_pc_address);
 #if DEBUG
         dra::outputTime("write basicblock : ");
         db->real_dump();
+        for (auto c : *write_basicblock->get_cmd_ctx()) {
+            std::cout << "cmd hex: " << std::hex << c->cmd << "\n";
+            this->DM.dump_ctxs(&c->ctx);
+        }
 #endif
+        w->input.reserve(db->input.size());
+        for (auto i : db->input) {
+            w->input.emplace_back(i.first->sig, i.second);
+        }
+    }
 
+    void DependencyControlCenter::write_basic_block_to_address(const WriteBasicBlock &w, WriteAddress *writeAddress) {
+        sta::Mod *write_basicblock = w.mod;
         std::vector<sta::cmd_ctx *> *cmd_ctx = write_basicblock->get_cmd_ctx();
         for (auto c : *cmd_ctx) {
-#if DEBUG
-            std::cout << "cmd hex: " << std::hex << c->cmd << "\n";
-            this->DM.dump_ctxs(&c->ctx);
-#endif
             auto ctx = c->ctx;
             auto inst = ctx.begin();
             std::string function_name = getFunctionName((*inst)->getParent()->getParent());
-            std::string file_operations;
-            std::string kind;
-            this->getFileOperations(&function_name, &file_operations, &kind);
-            int index = 0;
-            for (u_int i = file_operations_kind_MIN; i < file_operations_kind_MAX; i++) {
-                if (file_operations_kind_Name(static_cast<file_operations_kind>(i)) == kind) {
-                    index = i;
-                    break;
-                }
-            }
-            (*writeAddress->mutable_file_operations_function())[file_operations] = 1 << index;
+            const FunctionFileOperations &fo = this->getFileOperations(function_name);
+            (*writeAddress->mutable_file_operations_function())[fo.file_operations] = 1 << fo.index;
 
         }
 
-        writeAddress->set_write_address(write_address);
+        writeAddress->set_write_address(w.write_address);
         writeAddress->mutable_run_time_date();
         if (write_basicblock->is_trait_fixed()) {
             writeAddress->set_kind(WriteStatementConstant);
@@ -329,36 +685,52 @@ namespace dra {
         //            }
         //        }
 
-        for (auto i : db->input) {
-            (*writeAddress->mutable_input())[i.first->sig] = i.second;
+        for (auto &i : w.input) {
+            (*writeAddress->mutable_input())[i.first] = i.second;
         }
     }
 
     void
-    DependencyControlCenter::write_basic_block_to_adttributes(sta::Mod *write_basicblock, writeAddressAttributes *waa) {
-        DBasicBlock *db = this->DM.get_DB_from_bb(write_basicblock->B);
-        unsigned int write_address = DM.getSyzkallerAddress(db->trace_pc_address);
-        waa->set_write_address(write_address);
-        waa->set_repeat(write_basicblock->repeat);
-        waa->set_prio(write_basicblock->prio + 100);
+    DependencyControlCenter::write_basic_block_to_adttributes(const WriteBasicBlock &w, writeAddressAttributes *waa) {
+        waa->set_write_address(w.write_address);
+        waa->set_repeat(w.mod->repeat);
+        waa->set_prio(w.mod->prio + 100);
     }
 
     void DependencyControlCenter::check_condition() {
         dra::Conditions *cs = client->GetCondition();
+        this->check_condition(cs);
+    }
+
+    void DependencyControlCenter::check_condition(Conditions *cs) {
         if (cs != nullptr) {
-            for (auto condition : *cs->mutable_condition()) {
-                sta::MODS *write_basicblock = get_write_basicblock(&condition);
-                if (write_basicblock == nullptr) {
-                } else {
-                    auto *wa = new WriteAddresses();
-                    wa->set_allocated_condition(&condition);
-                    for (auto &x : *write_basicblock) {
-                        WriteAddress *writeAddress = wa->add_write_address();
-                        write_basic_block_to_address(x, &condition, writeAddress);
+            std::vector<std::pair<u_int64_t, u_int32_t>> queries;
+            for (auto &condition : cs->condition()) {
+                queries.emplace_back(condition.condition_address(), get_branch_index(&condition));
+            }
+            std::vector<Device *> pinned = this->prefetch_write_basicblock(queries);
+            std::vector<WriteAddresses *> was;
+            {
+                std::lock_guard<std::mutex> guard(this->dataLock);
+                for (auto &condition : *cs->mutable_condition()) {
+                    sta::MODS *write_basicblock = get_write_basicblock(&condition);
+                    if (write_basicblock == nullptr) {
+                    } else {
+                        auto *wa = new WriteAddresses();
+                        *wa->mutable_condition() = condition;
+                        for (auto &x : *write_basicblock) {
+                            WriteAddress *writeAddress = wa->add_write_address();
+                            write_basic_block_to_address(x, writeAddress);
+                        }
+                        was.push_back(wa);
                     }
-                    send_write_address(wa);
                 }
             }
+            this->release_devices(pinned);
+            for (auto wa : was) {
+                send_write_address(wa);
+                delete wa;
+            }
             cs->Clear();
         } else {
         }
@@ -376,26 +748,63 @@ namespace dra {
     }
 
 
-    void DependencyControlCenter::getFileOperations(std::string *function_name, std::string *file_operations,
-                                                    std::string *kind) {
-        for (const auto &f1 : this->config_json.items()) {
-            for (const auto &f2 : f1.value()["function"].items()) {
-                for (const auto &f3 : f2.value().items()) {
-                    if (*function_name == f3.value()["name"]) {
-                        file_operations->assign(f2.key());
-                        kind->assign(f3.key());
+    const DependencyControlCenter::FunctionFileOperations &
+    DependencyControlCenter::getFileOperations(const std::string &function_name) const {
+        auto fo = this->functionFileOperations.find(function_name);
+        if (fo == this->functionFileOperations.end()) {
+            return this->noFileOperations;
+        }
+        return fo->second;
+    }
+
+    void DependencyControlCenter::build_file_operations() {
+        this->functionFileOperations.clear();
+        //in the order of the config, so that the last file_operations having the function wins
+        for (const auto &dev : this->config_json.items()) {
+            auto function = dev.value().find("function");
+            if (function == dev.value().end()) {
+                continue;
+            }
+            for (const auto &fo : function->items()) {
+                for (const auto &k : fo.value().items()) {
+                    if (!k.value().is_object()) {
+                        continue;
                     }
+                    auto name = k.value().find("name");
+                    if (name == k.value().end() || !name->is_string()) {
+                        continue;
+                    }
+                    FunctionFileOperations &f = this->functionFileOperations[name->get<std::string>()];
+                    f.file_operations = fo.key();
+                    f.kind = k.key();
+                    f.index = get_file_operations_index(f.kind);
                 }
             }
         }
+        this->noFileOperations.index = get_file_operations_index(this->noFileOperations.kind);
+        dra::outputTime("file_operations functions : " + std::to_string(this->functionFileOperations.size()));
+    }
+
+    uint32_t DependencyControlCenter::get_file_operations_index(const std::string &kind) {
+        uint32_t index = 0;
+        for (u_int i = file_operations_kind_MIN; i < file_operations_kind_MAX; i++) {
+            if (file_operations_kind_Name(static_cast<file_operations_kind>(i)) == kind) {
+                index = i;
+                break;
+            }
+        }
+        return index;
     }
 
     void dra::DependencyControlCenter::test_sta() {
-        auto f = this->DM.Modules->Function["block/blk-core.c"]["blk_flush_plug_list"];
+        auto f = this->DM.Modules->get_DF_from_name("block/blk-core.c", "blk_flush_plug_list");
+        if (f == nullptr) {
+            return;
+        }
         for (const auto &B : f->BasicBlock) {
             auto b = B.second->basicBlock;
             std::cout << "b name : " << B.second->name << std::endl;
-            auto sta = this->getStaticAnalysisResult(B.second->parent->Path);
+            auto sta = this->getStaticAnalysisResult(B.second->parent);
             if (sta == nullptr) {
                 continue;
             }
@@ -409,6 +818,7 @@ namespace dra {
             } else if (!allBasicblock->empty()) {
                 std::cout << "allBasicblock != nullptr && allBasicblock->size() != 0" << std::endl;
             }
+            sta::StaticAnalysisResult::releaseMods(allBasicblock);
         }
 
         exit(0);
@@ -432,21 +842,155 @@ namespace dra {
         exit(0);
     }
 
-    sta::StaticAnalysisResult *DependencyControlCenter::getStaticAnalysisResult(const std::string &path) {
+    void DependencyControlCenter::build_device_route() {
+        this->STA_pattern.clear();
+        this->STA_path.clear();
+        this->STA_function.clear();
         for (const auto &dev : this->config_json.items()) {
-            auto path_s = dev.value()["path_s"];
-            for (const auto &pp : path_s.items()) {
-                if (path.find(pp.value()) != std::string::npos) {
-                    if (this->STA_map.find(dev.key()) != this->STA_map.end()) {
-                        return this->STA_map[dev.key()];
-                    } else {
-                        std::cerr << "can not find static analysis result for dev : " << dev.key() << std::endl;
-                    }
+            for (const auto &pp : dev.value()["path_s"].items()) {
+                this->STA_pattern.emplace_back(pp.value(), &this->devices[dev.key()]);
+            }
+        }
+        for (auto *f : this->DM.Modules->AllFunction) {
+            this->STA_function[f] = this->get_device(f->Path);
+        }
+#if DEBUG
+        dra::outputTime("device route : " + std::to_string(this->STA_path.size()) + " paths");
+#endif
+    }
+
+    sta::StaticAnalysisResult *DependencyControlCenter::getStaticAnalysisResult(const std::string &path) {
+        return this->load_device(this->get_device(path));
+    }
+
+    sta::StaticAnalysisResult *DependencyControlCenter::getStaticAnalysisResult(const dra::DFunction *df) {
+        return this->load_device(this->get_device(df));
+    }
+
+    DependencyControlCenter::Device *DependencyControlCenter::get_device(const std::string &path) {
+        std::lock_guard<std::mutex> guard(this->routeLock);
+        auto route = this->STA_path.find(path);
+        if (route != this->STA_path.end()) {
+            return route->second;
+        }
+        //The first path_s contained in the path wins, in the order of the devices and paths in the config.
+        Device *res = nullptr;
+        for (const auto &pp : this->STA_pattern) {
+            if (path.find(pp.first) != std::string::npos) {
+                res = pp.second;
+                break;
+            }
+        }
+#if DEBUG
+        if (res == nullptr) {
+            std::cerr << "can not find static analysis result for path : " << path << std::endl;
+        }
+#endif
+        this->STA_path[path] = res;
+        return res;
+    }
+
+    DependencyControlCenter::Device *DependencyControlCenter::get_device(const dra::DFunction *df) {
+        auto route = this->STA_function.find(df);
+        if (route != this->STA_function.end()) {
+            return route->second;
+        }
+        return this->get_device(df->Path);
+    }
+
+    sta::StaticAnalysisResult *DependencyControlCenter::load_device(Device *dev) {
+        if (dev == nullptr) {
+            return nullptr;
+        }
+        std::lock_guard<std::mutex> guard(this->deviceLock);
+        dev->last_use = ++this->use_clock;
+        if (dev->sta == nullptr) {
+            if (this->maxLoadedSTA != 0) {
+                this->free_devices(this->maxLoadedSTA - 1);
+            }
+            //A result which fails to load is kept like a loaded one, its queries find nothing.
+            auto sar = new sta::StaticAnalysisResult();
+            sar->initStaticRes(dev->file_taint, &this->DM);
+            dev->sta = sar;
+            this->numberLoadedSTA++;
+            this->load_write_table(dev);
+            dra::outputTime("load static analysis result of " + dev->name);
+        }
+        return dev->sta;
+    }
+
+    void DependencyControlCenter::load_devices() {
+        auto start = std::chrono::steady_clock::now();
+        std::vector<Device *> pending;
+        for (auto &d : this->devices) {
+            if (d.second.sta == nullptr) {
+                pending.push_back(&d.second);
+            }
+        }
+        std::vector<sta::StaticAnalysisResult *> res(pending.size());
+        dra::parallel_for(pending.size(), this->DM.Modules->NumberThread, [&](uint64_t i) {
+            res[i] = new sta::StaticAnalysisResult();
+            //the devices already use the threads, decode the tables of each one serially
+            res[i]->readStaticRes(pending[i]->file_taint, &this->DM, 1);
+        });
+        //The location index materializes the functions, which is not thread safe.
+        std::lock_guard<std::mutex> guard(this->deviceLock);
+        for (uint64_t i = 0; i < pending.size(); i++) {
+            res[i]->buildLocationIndex();
+            pending[i]->sta = res[i];
+            pending[i]->last_use = ++this->use_clock;
+            this->numberLoadedSTA++;
+            this->load_write_table(pending[i]);
+        }
+        std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+        dra::outputTime("static analysis results of " + std::to_string(pending.size()) + " devices : " +
+                        std::to_string(d.count()) + " s");
+    }
+
+    void DependencyControlCenter::trim_devices() {
+        std::lock_guard<std::mutex> guard(this->deviceLock);
+        this->free_devices(this->maxLoadedSTA);
+    }
+
+    void DependencyControlCenter::free_devices(uint32_t limit) {
+        if (!this->lazySTA || this->maxLoadedSTA == 0) {
+            return;
+        }
+        while (this->numberLoadedSTA > limit) {
+            Device *lru = nullptr;
+            for (auto &d : this->devices) {
+                if (d.second.sta != nullptr && d.second.in_use == 0 &&
+                    (lru == nullptr || d.second.last_use < lru->last_use)) {
+                    lru = &d.second;
                 }
             }
+            //the rest is in use, it is freed once it is released
+            if (lru == nullptr) {
+                break;
+            }
+            for (auto &bb : lru->staticResult) {
+                for (auto &r : bb.second) {
+                    sta::StaticAnalysisResult::releaseMods(r.second);
+                }
+            }
+            lru->staticResult.clear();
+            delete lru->sta;
+            lru->sta = nullptr;
+            this->numberLoadedSTA--;
+            dra::outputTime("free static analysis result of " + lru->name);
+        }
+    }
+
+    void DependencyControlCenter::load_write_table(Device *dev) {
+        std::string path = dev->file_taint + ".writes";
+        if (!llvm::sys::fs::exists(path)) {
+            return;
+        }
+        uint64_t key[2];
+        this->get_write_table_key(dev->file_taint, key);
+        if (dev->sta->loadWriteTable(path, key)) {
+            dra::outputTime("read write table " + path);
         }
-        std::cerr << "can not find static analysis result for path : " << path << std::endl;
-        return nullptr;
     }
 
     void DependencyControlCenter::check_all_condition_() {
@@ -505,6 +1049,7 @@ namespace dra {
 #endif
                         std::cerr << "!write_basicblock->empty()" << std::endl;
                     }
+                    sta::StaticAnalysisResult::releaseMods(write_basicblock);
                 }
             }
         }
@@ -513,13 +1058,18 @@ namespace dra {
     }
 
     void DependencyControlCenter::send_number_basicblock_covered() {
-        this->client->SendNumberBasicBlockCovered(DM.Modules->NumberBasicBlockCovered);
+        uint32_t number;
+        {
+            std::lock_guard<std::mutex> guard(this->dataLock);
+            number = DM.Modules->NumberBasicBlockCovered;
+        }
+        this->client->SendNumberBasicBlockCovered(number);
     }
 
 
-    sta::MODS *DependencyControlCenter::get_write_basicblock(Condition *u) {
+    u_int32_t DependencyControlCenter::get_branch_index(const Condition *u) {
         int64_t successor = u->successor();
-        int64_t idx;
+        u_int32_t idx;
         if (successor == 1) {
             idx = 0;
         } else if (successor == 2) {
@@ -530,15 +1080,18 @@ namespace dra {
             std::cerr << "switch case : " << std::hex << successor << std::endl;
 #endif
         }
-        return get_write_basicblock(u->condition_address(), idx);
+        return idx;
+    }
+
+    sta::MODS *DependencyControlCenter::get_write_basicblock(Condition *u) {
+        return get_write_basicblock(u->condition_address(), get_branch_index(u));
 
     }
 
 
     sta::MODS *DependencyControlCenter::get_write_basicblock(u_int64_t address, u_int32_t idx) {
-        dra::DBasicBlock *dbb;
-        if (this->DM.Address2BB.find(address) != this->DM.Address2BB.end()) {
-            dbb = DM.Address2BB[address]->parent;
+        dra::DBasicBlock *dbb = DM.get_DB_from_address(address);
+        if (dbb != nullptr) {
 #if DEBUG
             dbb->dump();
 #endif
@@ -552,23 +1105,33 @@ namespace dra {
     sta::MODS *DependencyControlCenter::get_write_basicblock(dra::DBasicBlock *db, u_int32_t idx) {
         sta::MODS *res = nullptr;
         auto *bb = dra::getFinalBB(db->basicBlock);
+        bool found = false;
+        Device *dev = this->get_device(db->parent);
+        if (dev == nullptr) {
+            return res;
+        }
 
 
 #if DEBUG
         dra::outputTime("GetAllGlobalWriteBBs : ");
 #endif
-        if ((this->staticResult.find(bb) != this->staticResult.end()) &&
-            (this->staticResult[bb].find(idx) != this->staticResult[bb].end())) {
-            res = this->staticResult[bb][idx];
+        auto &staticResult = dev->staticResult;
+        if ((staticResult.find(bb) != staticResult.end()) &&
+            (staticResult[bb].find(idx) != staticResult[bb].end())) {
+            res = staticResult[bb][idx];
+            dev->last_use = ++this->use_clock;
 #if DEBUG
             dra::outputTime("get useful static analysis result from cache");
 #endif
         } else {
-            auto sta = this->getStaticAnalysisResult(db->parent->Path);
+            auto sta = this->load_device(dev);
             if (sta == nullptr) {
                 return res;
             }
-            sta::MODS *write_basicblock = sta->GetAllGlobalWriteBBs(bb, idx);
+            sta::MODS *write_basicblock = sta->lookupWriteBBs(db->trace_pc_address, idx, &found);
+            if (!found) {
+                write_basicblock = sta->GetAllGlobalWriteBBs(bb, idx);
+            }
             if (write_basicblock == nullptr) {
                 // no taint or out side
 #if DEBUG
@@ -590,12 +1153,157 @@ namespace dra {
 #endif
             }
 
-            this->staticResult[bb].insert(std::pair<uint64_t, sta::MODS *>(idx, res));
+            staticResult[bb].insert(std::pair<uint64_t, sta::MODS *>(idx, res));
         }
 
         return res;
     }
 
+    std::vector<DependencyControlCenter::Device *>
+    DependencyControlCenter::prefetch_write_basicblock(const std::vector<std::pair<u_int64_t, u_int32_t>> &queries) {
+        std::unique_lock<std::mutex> lock(this->dataLock);
+        std::vector<Device *> pinned;
+        //The queries of each device, in the order they are first seen.
+        std::map<Device *, std::vector<std::pair<llvm::BasicBlock *, unsigned int>>> batches;
+        std::set<std::pair<llvm::BasicBlock *, u_int32_t>> seen;
+        for (auto &q : queries) {
+            dra::DBasicBlock *db = DM.get_DB_from_address(q.first);
+            if (db == nullptr || db->basicBlock == nullptr) {
+                continue;
+            }
+            Device *dev = this->get_device(db->parent);
+            if (dev == nullptr) {
+                continue;
+            }
+            //in use before it is loaded, so that loading another device does not free it
+            if (std::find(pinned.begin(), pinned.end(), dev) == pinned.end()) {
+                std::lock_guard<std::mutex> guard(this->deviceLock);
+                dev->in_use++;
+                pinned.push_back(dev);
+            }
+            auto *bb = dra::getFinalBB(db->basicBlock);
+            auto cached = dev->staticResult.find(bb);
+            if (cached != dev->staticResult.end() && cached->second.find(q.second) != cached->second.end()) {
+                continue;
+            }
+            if (!seen.insert(std::make_pair(bb, q.second)).second) {
+                continue;
+            }
+            auto sta = this->load_device(dev);
+            if (sta == nullptr) {
+                continue;
+            }
+            bool found = false;
+            sta::MODS *res = sta->lookupWriteBBs(db->trace_pc_address, q.second, &found);
+            if (found) {
+                dev->staticResult[bb].insert(std::pair<uint64_t, sta::MODS *>(q.second, res));
+                continue;
+            }
+            batches[dev].emplace_back(bb, q.second);
+        }
+        uint32_t thread = this->queryThread.load();
+        if (thread == 0) {
+            thread = this->DM.Modules->NumberThread;
+        }
+        for (auto &b : batches) {
+            //The queries only read the module if the locations are indexed and the functions are all materialized,
+            //the caches of the STA are filled under its own locks and its dominator trees are numbered before use.
+            bool reentrant = b.first->sta->useLocationIndex && !this->DM.Modules->Lazy;
+            if (reentrant) {
+                lock.unlock();
+            }
+            std::vector<sta::MODS *> res = b.first->sta->GetAllGlobalWriteBBs(b.second, thread);
+            if (reentrant) {
+                lock.lock();
+            }
+            for (uint64_t i = 0; i < res.size(); i++) {
+                //another worker may have cached the same query meanwhile
+                if (!b.first->staticResult[b.second[i].first].insert(
+                        std::pair<uint64_t, sta::MODS *>(b.second[i].second, res[i])).second) {
+                    sta::StaticAnalysisResult::releaseMods(res[i]);
+                }
+            }
+        }
+#if DEBUG
+        dra::outputTime("prefetch_write_basicblock : " + std::to_string(seen.size()));
+#endif
+        return pinned;
+    }
+
+    void DependencyControlCenter::release_devices(const std::vector<Device *> &devs) {
+        std::lock_guard<std::mutex> lock(this->dataLock);
+        std::lock_guard<std::mutex> guard(this->deviceLock);
+        bool idle = false;
+        for (auto dev : devs) {
+            if (--dev->in_use == 0) {
+                idle = true;
+            }
+        }
+        //the results loaded over the limit while these were in use
+        if (idle) {
+            this->free_devices(this->maxLoadedSTA);
+        }
+    }
+
+    void DependencyControlCenter::get_write_table_key(const std::string &file_taint, uint64_t *key) {
+        uint32_t thread = this->DM.Modules->NumberThread;
+        if (this->kernel_key == 0) {
+            uint64_t kernel[2] = {DSnapshot::hashFile(this->obj_dump, thread),
+                                  DSnapshot::hashFile(this->bit_code, thread)};
+            this->kernel_key = llvm::xxHash64(llvm::StringRef(reinterpret_cast<const char *>(kernel), sizeof(kernel)));
+        }
+        key[0] = DSnapshot::hashFile(file_taint, thread);
+        key[1] = this->kernel_key;
+    }
+
+    void DependencyControlCenter::precompute_write_basicblock() {
+        this->DM.Modules->materializeAll();
+        //The conditions of each device, by the trace_pc address of their DBasicBlock.
+        std::map<Device *, std::vector<uint64_t>> addresses;
+        std::map<Device *, std::vector<std::pair<llvm::BasicBlock *, unsigned int>>> batches;
+        for (auto &f : *this->DM.Modules->module) {
+            auto df = this->DM.Modules->get_DF_from_f(&f);
+            if (df == nullptr) {
+                continue;
+            }
+            auto dev = this->get_device(df);
+            if (dev == nullptr) {
+                continue;
+            }
+            for (auto &bb : df->BasicBlock) {
+                if (bb.second->trace_pc_address == 0) {
+                    continue;
+                }
+                auto fbb = getFinalBB(bb.second->basicBlock);
+                auto inst = fbb->getTerminator();
+                if (inst->getNumSuccessors() <= 1) {
+                    continue;
+                }
+                //get_branch_index only asks for the first two successors.
+                for (unsigned int idx = 0; idx < 2; idx++) {
+                    addresses[dev].push_back(bb.second->trace_pc_address);
+                    batches[dev].emplace_back(fbb, idx);
+                }
+            }
+        }
+        //One device at a time, so that a lazy run keeps no more results than it is allowed to.
+        for (auto &b : batches) {
+            Device *dev = b.first;
+            auto &queries = b.second;
+            auto sta = this->load_device(dev);
+            std::vector<sta::MODS *> res = sta->GetAllGlobalWriteBBs(queries, this->DM.Modules->NumberThread);
+            uint64_t key[2];
+            this->get_write_table_key(dev->file_taint, key);
+            if (sta->writeWriteTable(dev->file_taint + ".writes", key, addresses[dev], queries, res)) {
+                dra::outputTime("write table " + dev->file_taint + ".writes : " + std::to_string(queries.size()));
+            }
+            for (auto *r : res) {
+                sta::StaticAnalysisResult::releaseMods(r);
+            }
+            this->trim_devices();
+        }
+    }
+
     void DependencyControlCenter::check_uncovered_addresses_dependnency(const std::string &file) {
 
         std::stringstream ss;
@@ -641,8 +1349,8 @@ namespace dra {
 
                     std::cout << "# Uncovered address address : 0x" << std::hex << unconvered_address << std::endl;
                     DBasicBlock *db_ua;
-                    if (this->DM.Address2BB.find(unconvered_address) != this->DM.Address2BB.end()) {
-                        db_ua = DM.Address2BB[unconvered_address]->parent;
+                    if (this->DM.get_DI_from_address(unconvered_address) != nullptr) {
+                        db_ua = DM.get_DB_from_address(unconvered_address);
                         if (db_ua == nullptr) {
                             std::cout << "db_ua == nullptr" << std::endl;
                             continue;
@@ -652,8 +1360,8 @@ namespace dra {
                     }
 
                     std::cout << "# condition address : 0x" << std::hex << condition_address << std::endl;
-                    if (this->DM.Address2BB.find(condition_address) != this->DM.Address2BB.end()) {
-                        DBasicBlock *db = DM.Address2BB[condition_address]->parent;
+                    if (this->DM.get_DI_from_address(condition_address) != nullptr) {
+                        DBasicBlock *db = DM.get_DB_from_address(condition_address);
                         if (db == nullptr) {
                             std::cout << "db == nullptr" << std::endl;
                             continue;
@@ -715,21 +1423,11 @@ namespace dra {
                                         auto ctx = c->ctx;
                                         auto inst = ctx.begin();
                                         std::string funtion_name = getFunctionName((*inst)->getParent()->getParent());
-                                        std::string file_operations;
-                                        std::string kind;
-                                        this->getFileOperations(&funtion_name, &file_operations, &kind);
-                                        int index = 0;
-                                        for (int i = file_operations_kind_MIN; i < file_operations_kind_MAX; i++) {
-                                            if (file_operations_kind_Name(static_cast<file_operations_kind>(i)) ==
-                                                kind) {
-                                                index = i;
-                                                break;
-                                            }
-                                        }
+                                        const FunctionFileOperations &fo = this->getFileOperations(funtion_name);
                                         std::cout << "funtion_name : " << funtion_name << std::endl;
-                                        std::cout << "file_operations : " << file_operations << std::endl;
-                                        std::cout << "kind : " << kind << std::endl;
-                                        std::cout << "index : " << index << std::endl;
+                                        std::cout << "file_operations : " << fo.file_operations << std::endl;
+                                        std::cout << "kind : " << fo.kind << std::endl;
+                                        std::cout << "index : " << fo.index << std::endl;
                                     }
                                     std::cout << "--------------------------------------------" << std::endl;
                                     D << " @ @" << "0x" << tdb->trace_pc_address << "@"
@@ -816,40 +1514,45 @@ namespace dra {
         float_t not_dependency = 0;
         float_t other = 0;
 
+        std::vector<DBasicBlock *> dbs;
         if (write.is_open()) {
             while (getline(write, Line)) {
                 uint64_t write_address = std::stoul(Line, nullptr, 16);
 
-                if (this->DM.Address2BB.find(write_address) != this->DM.Address2BB.end()) {
-                    DBasicBlock *db = DM.Address2BB[write_address]->parent;
-                    if (db == nullptr) {
-                        std::cout << "db == nullptr" << std::endl;
-                        other++;
-                        continue;
-                    } else {
-                        if (this->is_dependency(db, 0)) {
-                            dependency++;
-                        } else {
-                            not_dependency++;
-                        }
-                    }
-                    FILE *fp;
-                    fp = fopen("statistic.txt", "a+");
-                    float_t total = dependency + not_dependency + other;
-                    if (total == 0) {
-                        fprintf(fp, "UncoveredWS@%.2f@%.2f@%.2f@%.2f@%.2f@\n", total, dependency, 1.0, not_dependency,
-                                other);
-                    } else {
-                        fprintf(fp, "UncoveredWS@%.2f@%.2f@%.2f@%.2f@%.2f@\n", total, dependency, dependency / total,
-                                not_dependency, other);
-                    }
-                    fclose(fp);
-
+                if (this->DM.get_DI_from_address(write_address) != nullptr) {
+                    dbs.push_back(DM.get_DB_from_address(write_address));
                 }
             }
         }
         write.close();
 
+        //the functions of all the write addresses are computed at once
+        std::vector<bool> res = this->is_dependency(dbs);
+        for (uint64_t i = 0; i < dbs.size(); i++) {
+            if (dbs[i] == nullptr) {
+                std::cout << "db == nullptr" << std::endl;
+                other++;
+                continue;
+            } else {
+                if (res[i]) {
+                    dependency++;
+                } else {
+                    not_dependency++;
+                }
+            }
+            FILE *fp;
+            fp = fopen("statistic.txt", "a+");
+            float_t total = dependency + not_dependency + other;
+            if (total == 0) {
+                fprintf(fp, "UncoveredWS@%.2f@%.2f@%.2f@%.2f@%.2f@\n", total, dependency, 1.0, not_dependency,
+                        other);
+            } else {
+                fprintf(fp, "UncoveredWS@%.2f@%.2f@%.2f@%.2f@%.2f@\n", total, dependency, dependency / total,
+                        not_dependency, other);
+            }
+            fclose(fp);
+        }
+
 
         // char buf[1024];
         // std::sprintf(buf, "%.2f@%.2f@%.2f@%.2f@%.2f@\n",total,dependency,dependency * 100 / total,not_dependency,other);
@@ -857,21 +1560,73 @@ namespace dra {
         // result << std::string(buf);
     }
 
-    bool DependencyControlCenter::is_dependency(dra::DBasicBlock *db, u_int64_t count) {
-        if (count > 200) {
-            return false;
+    bool DependencyControlCenter::is_dependency(dra::DBasicBlock *db) {
+        std::vector<dra::DBasicBlock *> dbs(1, db);
+        return this->is_dependency(dbs)[0];
+    }
+
+    std::vector<bool> DependencyControlCenter::is_dependency(const std::vector<dra::DBasicBlock *> &dbs) {
+        std::vector<dra::DFunction *> functions;
+        for (auto db : dbs) {
+            if (db != nullptr && db->parent != nullptr && this->dependencyFunction.insert(db->parent).second) {
+                functions.push_back(db->parent);
+            }
         }
-        for (auto *Pred : llvm::predecessors(getRealBB(db->basicBlock))) {
-            auto db1 = this->DM.get_DB_from_bb(Pred);
-            if (this->get_write_basicblock(db1) == nullptr) {
-                if (this->is_dependency(db1, count + 1)) {
-                    return true;
+
+        //The edges of the blocks of every function, resolved once, and the write basic blocks of their heads.
+        std::vector<std::unordered_map<dra::DBasicBlock *, std::vector<dra::DBasicBlock *>>> successors(
+                functions.size());
+        std::vector<std::pair<u_int64_t, u_int32_t>> queries;
+        for (uint64_t i = 0; i < functions.size(); i++) {
+            functions[i]->materialize();
+            for (auto &b : functions[i]->BasicBlock) {
+                dra::DBasicBlock *db = b.second;
+                if (db->basicBlock == nullptr) {
+                    continue;
+                }
+                for (auto *Pred : llvm::predecessors(getRealBB(db->basicBlock))) {
+                    auto pred = this->DM.get_DB_from_bb(Pred);
+                    if (pred == nullptr) {
+                        continue;
+                    }
+                    auto &s = successors[i][pred];
+                    if (s.empty() && pred->trace_pc_address != 0) {
+                        queries.emplace_back(pred->trace_pc_address, 0);
+                    }
+                    s.push_back(db);
+                }
+            }
+        }
+        std::vector<Device *> pinned = this->prefetch_write_basicblock(queries);
+
+        //A block depends on a write basic block if it can be reached from a block having one, by at least one edge.
+        for (auto &function : successors) {
+            std::vector<dra::DBasicBlock *> work;
+            for (auto &s : function) {
+                if (this->get_write_basicblock(s.first) != nullptr) {
+                    work.push_back(s.first);
+                }
+            }
+            while (!work.empty()) {
+                auto s = function.find(work.back());
+                work.pop_back();
+                if (s == function.end()) {
+                    continue;
+                }
+                for (auto succ : s->second) {
+                    if (this->dependencyBB.insert(succ).second) {
+                        work.push_back(succ);
+                    }
                 }
-            } else {
-                return true;
             }
         }
-        return false;
+        this->release_devices(pinned);
+
+        std::vector<bool> res(dbs.size(), false);
+        for (uint64_t i = 0; i < dbs.size(); i++) {
+            res[i] = dbs[i] != nullptr && this->dependencyBB.find(dbs[i]) != this->dependencyBB.end();
+        }
+        return res;
     }
 
     void DependencyControlCenter::check_coverage(const std::string &file) {
@@ -884,8 +1639,8 @@ namespace dra {
             while (getline(write, Line)) {
                 uint64_t write_address = std::stoul(Line, nullptr, 16);
 
-                if (this->DM.Address2BB.find(write_address) != this->DM.Address2BB.end()) {
-                    auto DInst = DM.Address2BB[write_address];
+                auto DInst = DM.get_DI_from_address(write_address);
+                if (DInst != nullptr) {
                     DInst->update(CoverKind::cover, nullptr);
                     DBasicBlock *db = DInst->parent;
                     if (db == nullptr) {
@@ -949,8 +1704,8 @@ namespace dra {
 
         auto check_control_dependency = [&, this]() {
             control_dependency << "@0x" << std::hex << uncovered_address;
-            if (this->DM.Address2BB.find(condition_address) != this->DM.Address2BB.end()) {
-                DBasicBlock *db = DM.Address2BB[condition_address]->parent;
+            if (this->DM.get_DI_from_address(condition_address) != nullptr) {
+                DBasicBlock *db = DM.get_DB_from_address(condition_address);
                 std::map<std::string, dra::DBasicBlock *> temp1;
                 control_dependency << "@" << std::dec << db->get_all_dominator_uncovered_instructions(temp1);;
                 control_dependency << "@" << std::dec << temp1.size();
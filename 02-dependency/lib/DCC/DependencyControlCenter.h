@@ -8,11 +8,22 @@
 #ifndef LIB_DCC_DEPENDENCYCONTROLCENTER_H_
 #define LIB_DCC_DEPENDENCYCONTROLCENTER_H_
 
+#include <atomic>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "../DMM/DataManagement.h"
 #include "../RPC/DependencyRPCClient.h"
 #include "../STA/StaticAnalysisResult.h"
+#include "general.h"
+
+//a dependency bigger than it is sent in chunks by its write addresses, a write address bigger than it in pieces
+#define DEPENDENCY_CHUNK_BYTES (64 << 20)
+//the bound of the tags, the lengths and the value of an entry of the maps of a write address besides its key
+#define DEPENDENCY_ENTRY_BYTES 32
 
 namespace dra {
 
@@ -25,6 +36,7 @@ namespace dra {
         void init(const std::string &obj_dump, const std::string &assembly, const std::string &bit_code,
                   const std::string &config, const std::string &port_address = "");
 
+        //Analyze the inputs and conditions as the manager streams them, or poll them if it has no streams.
         void run();
 
         void check_coverage(const std::string &file);
@@ -39,27 +51,102 @@ namespace dra {
 
         void setRPCConnection(const std::string &grpc_port);
 
+        void setSnapshot(bool snapshot);
+
+        void setLazy(bool lazy);
+
+        //Load the static analysis result of a device on the first query routed to it instead of all of them in init,
+        //and keep at most max_loaded of them (0 means no limit), the least recently used which no batch or input
+        //uses is freed before another one is loaded.
+        void setLazySTA(bool lazy, uint32_t max_loaded = 0);
+
+        //Analyze the streamed inputs on workers threads (0 means one per core), with at most depth of them queued
+        //between two stages of the pipeline. The workers only share dataLock to look up DM and the cached results,
+        //except with -lazy, where a batch of queries materializes functions and so runs under it.
+        void setPipeline(uint32_t workers, uint32_t depth);
+
         void send_number_basicblock_covered();
 
+        //What the analysis of an input needs, copied out of its DInput, which the next input with its sig changes.
+        struct InputJob {
+            std::string sig;
+            std::string program;
+            std::vector<u_int64_t> conditions;
+            std::vector<Condition> uncovered;
+            //the dependencies of the uncovered addresses, found by analyze_input
+            std::vector<Dependency *> dependencies;
+        };
+
+        //A write basic block with what its WriteAddress needs of DM, resolved under dataLock.
+        struct WriteBasicBlock {
+            sta::Mod *mod{};
+            unsigned int write_address{};
+            //the sig of the inputs covering it and their idx
+            std::vector<std::pair<std::string, uint64_t>> input;
+        };
+
+        //An uncovered address of an input with what its Dependency needs of DM, resolved under dataLock.
+        struct UncoveredDependency {
+            Condition *uncovered{};
+            unsigned long long int condition_address{};
+            unsigned long long int uncovered_address{};
+            std::vector<unsigned long long int> right_branch_address;
+            //the DBasicBlock of the uncovered address is known
+            bool basicblock{};
+            uint32_t number_arrive_basicblocks{};
+            uint32_t number_dominator_instructions{};
+            //cached by get_write_basicblock, kept while its device is in use
+            sta::MODS *write_basicblock{};
+            std::vector<WriteBasicBlock> write;
+        };
+
+        //Copy the conditions and the uncovered addresses of the input, the caller holds dataLock.
+        InputJob *prepare_input(DInput *dInput);
+
+        //Query the static analysis results of the input and build its dependencies.
+        void analyze_input(InputJob *job);
+
+        //Send the dependencies of the input in one stream and free it.
+        void send_input(InputJob *job);
+
         void check_input(DInput *dInput);
 
+        void check_inputs(Inputs *newInput);
+
         sta::MODS *get_write_basicblock(Condition *u);
 
         sta::MODS *get_write_basicblock(u_int64_t address, u_int32_t idx = 0);
 
         sta::MODS *get_write_basicblock(dra::DBasicBlock *db, u_int32_t idx = 0);
 
-        void write_basic_block_to_address(sta::Mod *write_basicblock, Condition *condition, WriteAddress *writeAddress);
+        //The branch of the condition that leads to the uncovered address.
+        static u_int32_t get_branch_index(const Condition *u);
+
+        //Query every condition of the kernel for both branches and write the results of each device
+        //to <file_taint>.writes, which init loads so that get_write_basicblock needs no query.
+        void precompute_write_basicblock();
 
-        void write_basic_block_to_adttributes(sta::Mod *write_basicblock, writeAddressAttributes *waa);
+        void write_basic_block_to_address(sta::Mod *write_basicblock, WriteAddress *writeAddress);
+
+        //What write_basic_block_to_address needs of DM, the caller holds dataLock.
+        void resolve_write_basicblock(sta::Mod *write_basicblock, WriteBasicBlock *w);
+
+        //Fill the WriteAddress of a resolved write basic block, without DM.
+        void write_basic_block_to_address(const WriteBasicBlock &w, WriteAddress *writeAddress);
+
+        static void write_basic_block_to_adttributes(const WriteBasicBlock &w, writeAddressAttributes *waa);
 
         static void set_runtime_data(runTimeData *r, const std::string &program, uint32_t idx, uint32_t condition,
                                      uint32_t address);
 
+        //Queue a dependency, which it owns, to the manager, split into chunks if it is too big. One that still
+        //can not be serialized is dropped and reported to the manager.
         void send_dependency(Dependency *dependency);
 
         void check_condition();
 
+        void check_condition(Conditions *cs);
+
         void send_write_address(WriteAddresses *writeAddress);
 
         void test_sta();
@@ -68,22 +155,130 @@ namespace dra {
 
         void test();
 
-        void getFileOperations(std::string *function_name, std::string *file_operations, std::string *kind);
+        //The file_operations of the config a function belongs to, its kind and the bit of the kind in
+        //WriteAddress.file_operations_function.
+        struct FunctionFileOperations {
+            std::string file_operations;
+            std::string kind;
+            uint32_t index{};
+        };
 
+        //The entry of the function in the index built by init, empty names if the config does not have it.
+        const FunctionFileOperations &getFileOperations(const std::string &function_name) const;
+
+        //The static analysis result of the device whose path_s matches the path, nullptr if none.
         sta::StaticAnalysisResult* getStaticAnalysisResult(const std::string& path);
 
-        bool is_dependency(dra::DBasicBlock *db, u_int64_t count);
+        //The same, resolved for every function in init.
+        sta::StaticAnalysisResult* getStaticAnalysisResult(const dra::DFunction *df);
+
+        //One device of the config, its static analysis result is loaded in init or on first use.
+        struct Device {
+            std::string name;
+            std::string file_taint;
+            sta::StaticAnalysisResult *sta{};
+            //the use_clock of the last query routed to it
+            uint64_t last_use{};
+            //the batches and inputs using its result, it is not freed before they release it
+            uint32_t in_use{};
+            //the results of get_write_basicblock, which point into sta and are freed with it
+            std::map<llvm::BasicBlock *, std::map<uint64_t, sta::MODS *>> staticResult;
+        };
+
+        //Query the static analysis results of all the (address, branch) pairs that are not cached yet at once,
+        //on the threads of the module, so that get_write_basicblock finds them in the cache.
+        //The caller does not hold dataLock, the batches run without it if the results allow it.
+        //The devices of the queries are returned in use, their cached results are kept until release_devices.
+        std::vector<Device *> prefetch_write_basicblock(const std::vector<std::pair<u_int64_t, u_int32_t>> &queries);
+
+        //Release the devices of prefetch_write_basicblock, the caller does not hold dataLock.
+        void release_devices(const std::vector<Device *> &devs);
+
+        //Whether a block before db in its function, a predecessor or one of theirs, has a write basic block.
+        bool is_dependency(dra::DBasicBlock *db);
+
+        //The same for every block, nullptr is false, the functions not computed yet are queried in one batch.
+        std::vector<bool> is_dependency(const std::vector<dra::DBasicBlock *> &dbs);
 
     private:
         DependencyRPCClient *client{};
         std::string port;
         DataManagement DM;
-        std::map<std::string, sta::StaticAnalysisResult*> STA_map;
+        std::map<std::string, Device> devices;
+        //path_s of all devices in the order of the config -> the device
+        std::vector<std::pair<std::string, Device *>> STA_pattern;
+        //the routes of the paths seen so far and of all the functions, nullptr if no device matches
+        std::unordered_map<std::string, Device *> STA_path;
+        std::unordered_map<const dra::DFunction *, Device *> STA_function;
+        std::mutex routeLock;
+
+        bool lazySTA{};
+        uint32_t maxLoadedSTA{};
+        uint32_t numberLoadedSTA{};
+        uint64_t use_clock{};
+        //Guards the loading, the use counts and the freeing of the results.
+        std::mutex deviceLock;
+
+        //Read StreamNewInput and StreamCondition on two threads and analyze every input and condition once it arrives,
+        //reconnect if the streams end. true once the manager is gone, false if it has no StreamNewInput.
+        bool run_stream();
+
+        //The stages after the stream until received is closed and drained: ingest the coverage of every input
+        //in the order of arrival, analyze the inputs on numberWorker threads and send their dependencies.
+        void run_pipeline(BoundedQueue<Inputs *> &received, const std::atomic<bool> &poll_condition);
+
+        uint32_t numberWorker{};
+        uint32_t queueDepth{64};
+        //the threads of one batch of queries, 0 means those of the module, also read by check_condition
+        std::atomic<uint32_t> queryThread{};
+
+        //Guards DM and the cached results of get_write_basicblock, which the stages of the pipeline share.
+        std::mutex dataLock;
+
+        void build_device_route();
+
+        Device *get_device(const std::string &path);
+
+        Device *get_device(const dra::DFunction *df);
+
+        //The static analysis result of the device, loaded if it is not yet, after freeing the least recently used
+        //ones over maxLoadedSTA. The caller holds dataLock if other threads use the results.
+        sta::StaticAnalysisResult *load_device(Device *dev);
+
+        //Load all the devices, their tables are deserialized in parallel.
+        void load_devices();
+
+        //Free the least recently used results until at most maxLoadedSTA are loaded.
+        void trim_devices();
+
+        //The same down to limit, skipping the results in use, the caller holds deviceLock and dataLock.
+        void free_devices(uint32_t limit);
+
+        void load_write_table(Device *dev);
         nlohmann::json config_json;
 
+        //function name -> its entry, of the last file_operations of the config which has it
+        std::unordered_map<std::string, FunctionFileOperations> functionFileOperations;
+        FunctionFileOperations noFileOperations;
+
+        void build_file_operations();
+
+        //the functions computed by is_dependency and their blocks that depend on a write basic block
+        std::unordered_set<const dra::DFunction *> dependencyFunction;
+        std::unordered_set<const dra::DBasicBlock *> dependencyBB;
+
+        //The position of the kind in file_operations_kind, as the bit of the kind was always looked up.
+        static uint32_t get_file_operations_index(const std::string &kind);
+
         std::time_t start_time{};
 
-        std::map<llvm::BasicBlock *, std::map<uint64_t, sta::MODS *>> staticResult;
+        std::string obj_dump;
+        std::string bit_code;
+        //the hash of the objdump and the bit code, 0 until the first write table needs it
+        uint64_t kernel_key{};
+
+        //The key of the write table of a taint_info file: its hash and the hash of the objdump and the bit code.
+        void get_write_table_key(const std::string &file_taint, uint64_t *key);
 
     };
 
@@ -4,6 +4,10 @@
 
 #include <string>
 #include <iostream>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <llvm/Config/llvm-config.h>
 #include <llvm/IR/BasicBlock.h>
 #include "llvm/IR/CFG.h"
 #include <llvm/IR/DebugLoc.h>
@@ -138,4 +142,44 @@ namespace dra {
     }
 
 
-}
\ No newline at end of file
+    void parallel_for(uint64_t number, uint32_t thread, const std::function<void(uint64_t)> &f) {
+        if (thread > number) {
+            thread = number;
+        }
+        if (thread <= 1) {
+            for (uint64_t i = 0; i < number; i++) {
+                f(i);
+            }
+            return;
+        }
+        std::atomic<uint64_t> next(0);
+        std::vector<std::thread> workers;
+        for (uint32_t t = 0; t < thread; t++) {
+            workers.emplace_back([&]() {
+                for (uint64_t i = next++; i < number; i = next++) {
+                    f(i);
+                }
+            });
+        }
+        for (auto &w : workers) {
+            w.join();
+        }
+    }
+
+    uint32_t number_thread() {
+        uint32_t thread = std::thread::hardware_concurrency();
+        if (thread == 0) {
+            thread = 1;
+        }
+        return thread;
+    }
+
+    llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> mapFile(const std::string &path) {
+#if LLVM_VERSION_MAJOR >= 13
+        return llvm::MemoryBuffer::getFile(path, /*IsText=*/false, /*RequiresNullTerminator=*/false);
+#else
+        return llvm::MemoryBuffer::getFile(path, /*FileSize=*/-1, /*RequiresNullTerminator=*/false);
+#endif
+    }
+
+}
@@ -5,11 +5,18 @@
 #ifndef INC_2018_Dependency_GENERAL_H
 #define INC_2018_Dependency_GENERAL_H
 
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
 #include <string>
 #include <csetjmp>
 #include <csignal>
 #include <iostream>
 #include <llvm/IR/BasicBlock.h>
+#include <llvm/Support/ErrorOr.h>
+#include <llvm/Support/MemoryBuffer.h>
 
 #define DEBUG 0
 #define DEBUG_ERR 0
@@ -29,6 +36,60 @@ namespace dra {
     void dump_inst(llvm::Instruction *inst);
 
     std::string dump_inst_booltin(llvm::Instruction *inst);
+
+    // run f(0) ... f(number - 1) on at most `thread` threads, items are handed out dynamically
+    void parallel_for(uint64_t number, uint32_t thread, const std::function<void(uint64_t)> &f);
+
+    uint32_t number_thread();
+
+    // map a whole file read-only, without a null terminator, so it is not copied
+    llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> mapFile(const std::string &path);
+
+    // the queue between two stages of a pipeline: push blocks while it is full, pop blocks while it is empty,
+    // after close push fails and pop returns what is left, then fails
+    template<class T>
+    class BoundedQueue {
+    public:
+        explicit BoundedQueue(size_t capacity) : capacity(capacity == 0 ? 1 : capacity), closed(false) {}
+
+        bool push(T item) {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->notFull.wait(lock, [&] { return this->items.size() < this->capacity || this->closed; });
+            if (this->closed) {
+                return false;
+            }
+            this->items.push_back(std::move(item));
+            this->notEmpty.notify_one();
+            return true;
+        }
+
+        bool pop(T &item) {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->notEmpty.wait(lock, [&] { return !this->items.empty() || this->closed; });
+            if (this->items.empty()) {
+                return false;
+            }
+            item = std::move(this->items.front());
+            this->items.pop_front();
+            this->notFull.notify_one();
+            return true;
+        }
+
+        void close() {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->closed = true;
+            this->notFull.notify_all();
+            this->notEmpty.notify_all();
+        }
+
+    private:
+        const size_t capacity;
+        bool closed;
+        std::deque<T> items;
+        std::mutex mutex;
+        std::condition_variable notFull;
+        std::condition_variable notEmpty;
+    };
 }
 
 #endif //INC_2018_Dependency_GENERAL_H
@@ -0,0 +1,109 @@
+/*
+ * DAddressIndex.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "DAddressIndex.h"
+
+#include <algorithm>
+#include <utility>
+
+// how many addresses of a call are looked up ahead of the current one
+#define PREFETCH_DISTANCE 8
+
+namespace dra {
+
+    DAddressIndex::DAddressIndex() {
+        Min = 0;
+        Max = 0;
+        Shift = 0;
+    }
+
+    DAddressIndex::~DAddressIndex() = default;
+
+    void DAddressIndex::build(std::vector<std::pair<uint64_t, DAInstruction *>> &entries) {
+        std::stable_sort(entries.begin(), entries.end(),
+                         [](const std::pair<uint64_t, DAInstruction *> &a,
+                            const std::pair<uint64_t, DAInstruction *> &b) {
+                             return a.first < b.first;
+                         });
+        Address.clear();
+        Inst.clear();
+        Bucket.clear();
+        Min = 0;
+        Max = 0;
+        Shift = 0;
+        Address.reserve(entries.size());
+        Inst.reserve(entries.size());
+        for (const auto &it : entries) {
+            if (!Address.empty() && Address.back() == it.first) {
+                Inst.back() = it.second;
+                continue;
+            }
+            Address.push_back(it.first);
+            Inst.push_back(it.second);
+        }
+        if (Address.empty()) {
+            return;
+        }
+
+        // about one address per bucket
+        Min = Address.front();
+        Max = Address.back();
+        while (((Max - Min) >> Shift) >= Address.size()) {
+            Shift++;
+        }
+        uint64_t number_bucket = ((Max - Min) >> Shift) + 1;
+        Bucket.resize(number_bucket + 1);
+        uint64_t i = 0;
+        for (uint64_t b = 0; b <= number_bucket; b++) {
+            while (i < Address.size() && ((Address[i] - Min) >> Shift) < b) {
+                i++;
+            }
+            Bucket[b] = (uint32_t) i;
+        }
+    }
+
+    DAInstruction *DAddressIndex::find(uint64_t address) const {
+        if (Address.empty() || address < Min || address > Max) {
+            return nullptr;
+        }
+        uint64_t b = (address - Min) >> Shift;
+        const uint64_t *base = Address.data() + Bucket[b];
+        uint64_t n = Bucket[b + 1] - Bucket[b];
+        if (n == 0) {
+            return nullptr;
+        }
+        // branch free binary search for the last address <= address in the bucket
+        while (n > 1) {
+            uint64_t half = n / 2;
+            base = (base[half] <= address) ? base + half : base;
+            n -= half;
+        }
+        if (*base != address) {
+            return nullptr;
+        }
+        return Inst[base - Address.data()];
+    }
+
+    void DAddressIndex::find(const std::vector<uint64_t> &address, std::vector<DAInstruction *> &res) const {
+        res.resize(address.size());
+        for (uint64_t i = 0; i < address.size(); i++) {
+            if (i + PREFETCH_DISTANCE < address.size()) {
+                uint64_t next = address[i + PREFETCH_DISTANCE];
+                if (!Address.empty() && next >= Min && next <= Max) {
+                    const uint32_t *b = Bucket.data() + ((next - Min) >> Shift);
+                    __builtin_prefetch(b);
+                    __builtin_prefetch(Address.data() + *b);
+                }
+            }
+            res[i] = find(address[i]);
+        }
+    }
+
+    uint64_t DAddressIndex::size() const {
+        return Address.size();
+    }
+
+} /* namespace dra */
@@ -0,0 +1,54 @@
+/*
+ * DAddressIndex.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef LIB_DRA_DADDRESSINDEX_H_
+#define LIB_DRA_DADDRESSINDEX_H_
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace dra {
+    class DAInstruction;
+} /* namespace dra */
+
+namespace dra {
+
+    // read only index from the address of an instruction to the instruction,
+    // built once from the instructions of the objdump or the snapshot: sorted addresses and the instructions
+    // in the same order.
+    // Bucket[b] is the first address whose (address - Min) >> Shift is b,
+    // so a lookup is one bucket and a short branch free search inside it.
+    class DAddressIndex {
+    public:
+        DAddressIndex();
+
+        virtual ~DAddressIndex();
+
+        // entries is sorted in place, if an address is given twice the later instruction is kept
+        void build(std::vector<std::pair<uint64_t, DAInstruction *>> &entries);
+
+        // nullptr if the address is not the address of an instruction
+        DAInstruction *find(uint64_t address) const;
+
+        // resolve all addresses of a call in one pass, res[i] is the instruction of address[i] or nullptr.
+        // the buckets of the next addresses are prefetched while the current one is looked up.
+        void find(const std::vector<uint64_t> &address, std::vector<DAInstruction *> &res) const;
+
+        uint64_t size() const;
+
+    public:
+        std::vector<uint64_t> Address;
+        std::vector<DAInstruction *> Inst;
+        std::vector<uint32_t> Bucket;
+        uint64_t Min;
+        uint64_t Max;
+        uint32_t Shift;
+    };
+
+} /* namespace dra */
+
+#endif /* LIB_DRA_DADDRESSINDEX_H_ */
@@ -0,0 +1,98 @@
+/*
+ * DArena.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef LIB_DRA_DARENA_H_
+#define LIB_DRA_DARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace dra {
+
+    // bump allocator for the objects of one type in a module.
+    // objects are placed one after another in chunks which grow from 16 to MaxChunk objects,
+    // and they are all destroyed and freed together with the arena.
+    // an arena is not thread safe: parallel parsers fill their own arena and merge it afterwards.
+    template<class T>
+    class DArena {
+    public:
+        static const size_t MaxChunk = 4096;
+
+        DArena() : Number(0) {}
+
+        DArena(const DArena &) = delete;
+
+        DArena &operator=(const DArena &) = delete;
+
+        DArena(DArena &&other) noexcept : Chunks(std::move(other.Chunks)), Number(other.Number) {
+            other.Chunks.clear();
+            other.Number = 0;
+        }
+
+        virtual ~DArena() {
+            clear();
+        }
+
+        template<class... Args>
+        T *create(Args &&... args) {
+            if (Chunks.empty() || Chunks.back().used == Chunks.back().capacity) {
+                size_t capacity = Chunks.empty() ? 16 : Chunks.back().capacity * 2;
+                if (capacity > MaxChunk) {
+                    capacity = MaxChunk;
+                }
+                Chunk c;
+                c.data = static_cast<T *>(::operator new(sizeof(T) * capacity));
+                c.used = 0;
+                c.capacity = capacity;
+                Chunks.push_back(c);
+            }
+            Chunk &c = Chunks.back();
+            T *object = new(c.data + c.used) T(std::forward<Args>(args)...);
+            c.used++;
+            Number++;
+            return object;
+        }
+
+        // take all objects of other, they keep their addresses
+        void merge(DArena &other) {
+            Chunks.insert(Chunks.end(), other.Chunks.begin(), other.Chunks.end());
+            Number += other.Number;
+            other.Chunks.clear();
+            other.Number = 0;
+        }
+
+        void clear() {
+            for (auto c = Chunks.rbegin(); c != Chunks.rend(); c++) {
+                for (size_t i = c->used; i > 0; i--) {
+                    c->data[i - 1].~T();
+                }
+                ::operator delete(c->data);
+            }
+            Chunks.clear();
+            Number = 0;
+        }
+
+        uint64_t size() const {
+            return Number;
+        }
+
+    private:
+        struct Chunk {
+            T *data;
+            size_t used;
+            size_t capacity;
+        };
+
+        std::vector<Chunk> Chunks;
+        uint64_t Number;
+    };
+
+} /* namespace dra */
+
+#endif /* LIB_DRA_DARENA_H_ */
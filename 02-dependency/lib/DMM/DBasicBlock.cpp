@@ -38,7 +38,7 @@ namespace dra {
         for (auto &it : *b) {
             DLInstruction *i;
 
-            i = new DLInstruction();
+            i = this->parent->parent->InstIRArena.create();
             InstIR.push_back(i);
 
             i->parent = this;
@@ -88,6 +88,9 @@ namespace dra {
     }
 
     void DBasicBlock::update(CoverKind kind, DInput *dInput) {
+        if (this->parent != nullptr) {
+            parent->materialize();
+        }
         setState(kind);
         for (auto it : InstIR) {
             it->setState(kind);
@@ -133,8 +136,8 @@ namespace dra {
         DBasicBlock *Db;
 
         std::string bname = b->getName().str();
-        if (parent->BasicBlock.find(bname) != parent->BasicBlock.end()) {
-            Db = parent->BasicBlock[bname];
+        Db = parent->get_DB_from_name(bname);
+        if (Db != nullptr) {
             if (Db->state < CoverKind::cover) {
                 Db->setState(CoverKind::cover);
                 Db->input.clear();
@@ -156,17 +159,17 @@ namespace dra {
         DBasicBlock *Db;
         std::string pname = p->getName().str();
         std::string bname = end->getSuccessor(i)->getName().str();
-        if (parent->BasicBlock.find(bname) != parent->BasicBlock.end()) {
-            Db = parent->BasicBlock[bname];
-            if (parent->BasicBlock.find(pname) != parent->BasicBlock.end()) {
-                Dp = parent->BasicBlock[pname];
+        Db = parent->get_DB_from_name(bname);
+        if (Db != nullptr) {
+            Dp = parent->get_DB_from_name(pname);
+            if (Dp != nullptr) {
 
                 std::vector<uint64_t> branch;
                 for (uint64_t j = 0, e = end->getNumSuccessors(); j < e; j++) {
                     if (end->getSuccessor(j)->hasName()) {
-                        auto n = end->getSuccessor(j)->getName();
-                        if (this->parent->BasicBlock.find(n) != this->parent->BasicBlock.end()) {
-                            branch.push_back(this->parent->BasicBlock[n]->trace_pc_address);
+                        auto *n = this->parent->get_DB_from_name(end->getSuccessor(j)->getName());
+                        if (n != nullptr) {
+                            branch.push_back(n->trace_pc_address);
                         }
                     }
                 }
@@ -370,8 +373,7 @@ namespace dra {
 
     DBasicBlock *DBasicBlock::get_DB_from_bb(llvm::BasicBlock *b) {
         llvm::BasicBlock *bb = dra::getRealBB(b);
-        std::string bbname = bb->getName().str();
-        DBasicBlock *db = this->parent->BasicBlock[bbname];
+        DBasicBlock *db = this->parent->get_DB_from_name(bb->getName());
         return db;
     }
 
@@ -15,6 +15,7 @@
 #include <llvm/IR/Instructions.h>
 #include <llvm/Analysis/CFG.h>
 #include "DataManagement.h"
+#include "DSymbol.h"
 #include "../DCC/general.h"
 #include <set>
 
@@ -25,6 +26,7 @@ namespace dra {
         AsmSourceCode = false;
         IR = false;
         Repeat = false;
+        Materialized = false;
 
         function = nullptr;
         parent = nullptr;
@@ -44,48 +46,97 @@ namespace dra {
         DT = nullptr;
     }
 
-    DFunction::~DFunction() = default;
+    DFunction::~DFunction() {
+        delete this->DT;
+    }
 
     void DFunction::InitIRFunction(llvm::Function *f) {
         DFunction::function = f;
-        this->DT = new llvm::DominatorTree(*f);
+        this->Materialized = true;
+        // the basic blocks may already exist if they are read from a snapshot
+        NumberBasicBlock = 0;
+        NumberBasicBlockReal = 0;
         std::string Name;
         DBasicBlock *b;
         int64_t no = 0;
+        DFunction *named = this->parent->FunctionOf.lookup(f);
         for (auto &it : *function) {
             if (it.hasName()) {
                 NumberBasicBlock++;
                 NumberBasicBlockReal++;
                 Name = it.getName().str();
-                if (BasicBlock.find(Name) == BasicBlock.end()) {
-                    b = new DBasicBlock();
-                    BasicBlock[Name] = b;
+                auto &slot = BasicBlock[DSymbol::intern(Name)];
+                if (slot == nullptr) {
+                    b = this->parent->BasicBlockArena.create();
+                    slot = b;
                     b->name = Name;
                     b->basicBlock = &it;
-                    BasicBlock[Name]->setIr(true);
-                    BasicBlock[Name]->parent = this;
+                    b->setIr(true);
+                    b->parent = this;
+                } else if (slot->basicBlock == nullptr) {
+                    b = slot;
+                    b->basicBlock = &it;
+                    b->setIr(true);
+                    b->parent = this;
                 } else {
                     std::cerr << "error same basic block name" << "\n";
+                    b = slot;
+                }
+                // the block of a repeat resolves to the block of the same name in the first function of its name
+                DBasicBlock *resolved = named == this ? b : named != nullptr ? named->get_DB_from_name(Name) : nullptr;
+                if (resolved != nullptr) {
+                    this->parent->BasicBlockOf[&it] = resolved;
                 }
             } else {
                 NumberBasicBlock++;
                 Name = std::to_string(no);
 
-                if (BasicBlock.find(Name) == BasicBlock.end()) {
-                    b = new DBasicBlock();
-                    BasicBlock[Name] = b;
+                auto &slot = BasicBlock[DSymbol::intern(Name)];
+                if (slot == nullptr) {
+                    b = this->parent->BasicBlockArena.create();
+                    slot = b;
                     b->name = Name;
                     b->basicBlock = &it;
-                    BasicBlock[Name]->setIr(true);
-                    BasicBlock[Name]->parent = this;
+                    b->setIr(true);
+                    b->parent = this;
+                } else if (slot->basicBlock == nullptr) {
+                    b = slot;
+                    b->basicBlock = &it;
+                    b->setIr(true);
+                    b->parent = this;
                 } else {
                     std::cerr << "error same basic block name"
                               << "\n";
+                    b = slot;
                 }
             }
             no++;
-            BasicBlock[Name]->InitIRBasicBlock(&it);
+            b->InitIRBasicBlock(&it);
+        }
+    }
+
+    DBasicBlock *DFunction::get_DB_from_name(llvm::StringRef name) const {
+        auto it = this->BasicBlock.find(DSymbol::lookup(name));
+        if (it == this->BasicBlock.end()) {
+            return nullptr;
+        }
+        return it->second;
+    }
+
+    void DFunction::materialize() {
+        if (this->Materialized || this->function == nullptr || this->parent == nullptr) {
+            return;
+        }
+        this->parent->materialize(this->function);
+        InitIRFunction(this->function);
+    }
+
+    llvm::DominatorTree *DFunction::getDominatorTree() {
+        materialize();
+        if (this->DT == nullptr && this->function != nullptr) {
+            this->DT = new llvm::DominatorTree(*this->function);
         }
+        return this->DT;
     }
 
     void DFunction::setState(CoverKind kind) {
@@ -181,18 +232,20 @@ namespace dra {
     }
 
     uint32_t DFunction::get_number_uncovered_instructions(std::map<std::string, dra::DBasicBlock *> &res) {
+        materialize();
         uint64_t uncovered_basicblock_number = 0;
         for (const auto &b : this->BasicBlock) {
             if (b.second->state != CoverKind::cover && b.second->basicBlock != nullptr &&
                 b.second->basicBlock->hasName()) {
                 uncovered_basicblock_number += b.second->get_number_uncovered_instructions();
-                res[this->FunctionName + b.first] = b.second;
+                res[this->FunctionName + b.second->name] = b.second;
             }
         }
         return 0;
     }
 
     void DFunction::get_function_call(std::set<llvm::Function *> &res) {
+        materialize();
         for (auto b : this->BasicBlock) {
             b.second->get_function_call(res);
         }
@@ -203,20 +256,20 @@ namespace dra {
                                                              std::map<std::string, dra::DBasicBlock *> &res) {
         uint32_t count = 0;
         if (b->hasName()) {
-            std::string Name = b->getName().str();
-            if (BasicBlock.find(Name) != BasicBlock.end()) {
-                if (this->BasicBlock[Name]->state != CoverKind::cover) {
-                    count = count + this->BasicBlock[Name]->get_number_uncovered_instructions();
-                    res[this->FunctionName + Name] = this->BasicBlock[Name];
+            DBasicBlock *db = get_DB_from_name(b->getName());
+            if (db != nullptr) {
+                if (db->state != CoverKind::cover) {
+                    count = count + db->get_number_uncovered_instructions();
+                    res[this->FunctionName + db->name] = db;
                 }
             }
         }
 
-        for (auto c : DT->getNode(dra::getFinalBB(b))->getChildren()) {
+        for (auto c : getDominatorTree()->getNode(dra::getFinalBB(b))->getChildren()) {
             if (c->getBlock()->hasName()) {
-                std::string Name = c->getBlock()->getName().str();
-                if (BasicBlock.find(Name) != BasicBlock.end()) {
-                    if (this->BasicBlock[Name]->state != CoverKind::cover) {
+                DBasicBlock *db = get_DB_from_name(c->getBlock()->getName());
+                if (db != nullptr) {
+                    if (db->state != CoverKind::cover) {
                         count = count + this->get_dominator_uncovered_instructions(c->getBlock(), res);
                     }
                 }
@@ -234,11 +287,11 @@ namespace dra {
     DFunction::get_uncovered_instructions(llvm::BasicBlock *b, std::map<std::string, dra::DBasicBlock *> &res) {
         uint32_t count = 0;
         if (b->hasName()) {
-            std::string Name = b->getName().str();
-            if (BasicBlock.find(Name) != BasicBlock.end()) {
-                if (this->BasicBlock[Name]->state != CoverKind::cover) {
-                    count = count + this->BasicBlock[Name]->get_number_uncovered_instructions();
-                    res[this->FunctionName + Name] = this->BasicBlock[Name];
+            DBasicBlock *db = get_DB_from_name(b->getName());
+            if (db != nullptr) {
+                if (db->state != CoverKind::cover) {
+                    count = count + db->get_number_uncovered_instructions();
+                    res[this->FunctionName + db->name] = db;
                 }
             }
         }
@@ -250,10 +303,10 @@ namespace dra {
         for (const auto &bb: this->BasicBlock) {
             if (bb.second->basicBlock != nullptr && bb.second->basicBlock != nullptr &&
                 bb.second->basicBlock->hasName()) {
-                if (llvm::isPotentiallyReachable(b, bb.second->basicBlock, this->DT)) {
+                if (llvm::isPotentiallyReachable(b, bb.second->basicBlock, this->getDominatorTree())) {
                     if (bb.second->state != CoverKind::cover) {
                         count = count + bb.second->get_number_uncovered_instructions();
-                        res[this->FunctionName + bb.first] = bb.second;
+                        res[this->FunctionName + bb.second->name] = bb.second;
                         bb.second->get_function_call(new_uncovered_functions);
                     }
                 }
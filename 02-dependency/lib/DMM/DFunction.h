@@ -39,6 +39,15 @@ namespace dra {
 
         void InitIRFunction(llvm::Function *f);
 
+        // load the body of a lazily read bit code function and build its basic blocks
+        void materialize();
+
+        // the dominator tree is built the first time it is queried
+        llvm::DominatorTree *getDominatorTree();
+
+        // nullptr if the function has no basic block with this name
+        DBasicBlock *get_DB_from_name(llvm::StringRef name) const;
+
         void setState(CoverKind kind);
 
         void update(CoverKind kind);
@@ -83,7 +92,7 @@ namespace dra {
         bool IR;
 
         bool Repeat;
-
+        bool Materialized;
 
         llvm::Function *function;
         DModule *parent;
@@ -100,7 +109,8 @@ namespace dra {
         std::vector<DAInstruction *> InstASM;
         unsigned int NumberBasicBlock;
         unsigned int NumberBasicBlockReal;
-        std::unordered_map<std::string, DBasicBlock *> BasicBlock;
+        // keyed by the DSymbol id of the basic block name
+        std::unordered_map<uint32_t, DBasicBlock *> BasicBlock;
 
         std::vector<llvm::BasicBlock *> path;
         std::set<llvm::BasicBlock *> order;
@@ -4,13 +4,18 @@
 #include <llvm/IR/Function.h>
 #include <llvm/IR/Module.h>
 #include <llvm/IRReader/IRReader.h>
+#include <llvm/Support/Error.h>
+#include <llvm/Support/MemoryBuffer.h>
 #include <llvm/Support/SourceMgr.h>
+#include <llvm/Support/raw_ostream.h>
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <sstream>
 
 #include "../RPC/Dependency.pb.h"
 #include "../DCC/general.h"
+#include "DSymbol.h"
 
 #define PATH_SIZE 10000
 
@@ -21,6 +26,8 @@ namespace dra {
         this->NumberBasicBlock = 0;
         this->NumberBasicBlockReal = 0;
         this->NumberBasicBlockCovered = 0;
+        this->NumberThread = dra::number_thread();
+        this->Lazy = false;
     }
 
     DModule::~DModule() = default;
@@ -33,7 +40,11 @@ namespace dra {
         llvm::LLVMContext *cxts;
         llvm::SMDiagnostic Err;
         cxts = new llvm::LLVMContext[1];
-        module = llvm::parseIRFile(InputFilename, Err, cxts[0]);
+        if (this->Lazy) {
+            module = llvm::getLazyIRFileModule(InputFilename, Err, cxts[0]);
+        } else {
+            module = llvm::parseIRFile(InputFilename, Err, cxts[0]);
+        }
 
         if (!module) {
             std::cerr << "load module: " << InputFilename << " failed\n";
@@ -45,8 +56,31 @@ namespace dra {
                 i.dump();
             }
 #endif
-            BuildLLVMFunction(module.get());
+            this->Numbering.index(*module);
+            if (!this->Lazy) {
+                BuildLLVMFunction(module.get());
+            }
+        }
+    }
+
+    void DModule::materialize(llvm::Function *f) {
+        if (f != nullptr && f->isMaterializable()) {
+            if (llvm::Error err = f->materialize()) {
+                llvm::logAllUnhandledErrors(std::move(err), llvm::errs(), "materialize " + f->getName() + " : ");
+            }
+        }
+    }
+
+    void DModule::materializeAll() {
+        if (!this->Lazy) {
+            return;
+        }
+        if (llvm::Error err = module->materializeAll()) {
+            llvm::logAllUnhandledErrors(std::move(err), llvm::errs(), "materialize module : ");
+            exit(0);
         }
+        this->Lazy = false;
+        BuildLLVMFunction(module.get());
     }
 
     void DModule::BuildLLVMFunction(llvm::Module *Module) {
@@ -58,12 +92,14 @@ namespace dra {
                 std::string FunctionName = dra::getFunctionName(&it);
                 function = CheckRepeatFunction(Path, FunctionName, dra::FunctionKind::IR);
                 function->IRName = name;
-                function->InitIRFunction(&it);
                 function->parent = this;
+                // a repeat resolves to the first function of its name
+                this->FunctionOf[&it] = get_DF_from_name(Path, FunctionName);
+                function->InitIRFunction(&it);
                 this->NumberBasicBlock += function->NumberBasicBlock;
                 this->NumberBasicBlockReal += function->NumberBasicBlockReal;
             } else {
-
+                this->FunctionOf[&it] = get_DF_from_name(Path, dra::getFunctionName(&it));
             }
 
         }
@@ -86,7 +122,189 @@ namespace dra {
         return data;
     }
 
-    void dra::DModule::ReadObjdump(const std::string &objdump) {
+    void DModule::ReadAddr2line(const std::string &objdump) {
+        std::string obj = objdump.substr(0, objdump.find(".objdump"));
+        std::string output_file = obj + ".bin";
+        std::fstream input(output_file, std::ios::in | std::ios::binary);
+        if (!this->addr2line->ParseFromIstream(&input)) {
+            std::cerr << "Failed to parse addr2line." << std::endl;
+        }
+        input.close();
+    }
+
+    namespace {
+        // the parts of one objdump chunk which matter for the merge, in file order.
+        // consecutive instruction lines are folded into one record and so are consecutive empty lines.
+        enum ObjdumpKind {
+            objdump_header, objdump_inst, objdump_empty,
+        };
+
+        struct ObjdumpRecord {
+            ObjdumpKind kind;
+            std::string Addr;
+            std::string FunctionName;
+            const std::string *Path;
+            unsigned int InstNum;
+            unsigned int JumpInstNum;
+            std::vector<DAInstruction *> InstASM;
+
+            explicit ObjdumpRecord(ObjdumpKind kind) : kind(kind), Path(nullptr), InstNum(0), JumpInstNum(0) {}
+        };
+    } /* namespace */
+
+    void DModule::ReadObjdump(const std::string &objdump) {
+        if (this->NumberThread <= 1) {
+            this->ReadObjdumpSerial(objdump);
+            return;
+        }
+#if DEBUG_OBJ_DUMP
+        std::cout << "*************************************************" << std::endl;
+        std::cout << "****************ReadObjdump**********************" << std::endl;
+        std::cout << "objdump :" << objdump << std::endl;
+#endif
+        this->ReadAddr2line(objdump);
+
+        auto buffer = dra::mapFile(objdump);
+        if (!buffer) {
+            std::cerr << "Unable to open objdump file " << objdump << "\n";
+            return;
+        }
+        llvm::StringRef file = (*buffer)->getBuffer();
+
+        // split the file at function headers, every chunk except the first one starts with a header
+        std::vector<size_t> boundary;
+        boundary.push_back(0);
+        uint64_t number = this->NumberThread * 8;
+        for (uint64_t i = 1; i < number; i++) {
+            size_t pos = file.find('\n', file.size() * i / number);
+            while (pos != llvm::StringRef::npos) {
+                pos++;
+                size_t end = file.find('\n', pos);
+                if (file.slice(pos, end).find(">:") != llvm::StringRef::npos) {
+                    break;
+                }
+                pos = end;
+            }
+            if (pos == llvm::StringRef::npos) {
+                break;
+            }
+            if (pos > boundary.back()) {
+                boundary.push_back(pos);
+            }
+        }
+        boundary.push_back(file.size());
+
+        const auto &addr = this->addr2line->addr();
+        std::vector<std::vector<ObjdumpRecord>> chunks(boundary.size() - 1);
+        std::vector<DArena<DAInstruction>> arenas(chunks.size());
+        dra::parallel_for(chunks.size(), this->NumberThread, [&](uint64_t c) {
+            auto &records = chunks[c];
+            size_t pos = boundary[c];
+            while (pos < boundary[c + 1]) {
+                size_t end = file.find('\n', pos);
+                if (end > boundary[c + 1]) {
+                    end = boundary[c + 1];
+                }
+                llvm::StringRef Line = file.slice(pos, end);
+                pos = end + 1;
+
+                if (Line.empty()) {
+                    if (records.empty() || records.back().kind != ObjdumpKind::objdump_empty) {
+                        records.emplace_back(ObjdumpKind::objdump_empty);
+                    }
+                } else if (Line.find(">:") != llvm::StringRef::npos) {
+                    records.emplace_back(ObjdumpKind::objdump_header);
+                    auto &record = records.back();
+                    record.Addr = Line.substr(0, 16).str();
+                    record.FunctionName = Line.slice(Line.find('<') + 1, Line.find('>')).str();
+                    auto it = addr.find(record.Addr);
+                    if (it != addr.end()) {
+                        record.Path = &it->second;
+                    }
+                } else if (Line[0] == '.' || Line[0] == 'D') {
+
+                } else {
+                    size_t colon = Line.find(':');
+                    if (colon == llvm::StringRef::npos || Line.size() - colon <= 23) {
+                        // deal with no asm
+                        continue;
+                    }
+                    if (records.empty() || records.back().kind != ObjdumpKind::objdump_inst) {
+                        records.emplace_back(ObjdumpKind::objdump_inst);
+                    }
+                    auto &record = records.back();
+                    record.InstNum++;
+
+                    llvm::StringRef Inst = Line.substr(colon + 24);
+                    if (Inst.empty()) {
+                        continue;
+                    }
+                    if (Inst[0] == 'c' && Inst.find("call") != llvm::StringRef::npos) {
+                        auto *inst = arenas[c].create();
+                        inst->setAddr(Line.substr(0, colon).ltrim(' ').str());
+                        inst->OInst = Inst.str();
+                        record.InstASM.push_back(inst);
+                    }
+                    if (Inst[0] == 'j') {
+                        record.JumpInstNum++;
+                    }
+                }
+            }
+        });
+
+        for (auto &arena : arenas) {
+            this->InstASMArena.merge(arena);
+        }
+
+        // merge in file order, same as the serial parser
+        std::string Path;
+        std::string FunctionName;
+        unsigned int InsNum = 0;
+        DFunction *function = nullptr;
+        for (auto &records : chunks) {
+            for (auto &record : records) {
+                switch (record.kind) {
+                    case ObjdumpKind::objdump_header: {
+                        FunctionName = std::move(record.FunctionName);
+                        if (record.Path != nullptr) {
+                            Path = *record.Path;
+                        } else {
+                            std::cerr << "Failed to get addr2line." << std::endl;
+                        }
+                        function = CheckRepeatFunction(Path, FunctionName, dra::FunctionKind::O);
+                        function->Address = std::move(record.Addr);
+                        break;
+                    }
+                    case ObjdumpKind::objdump_inst: {
+                        InsNum += record.InstNum;
+                        if (function == nullptr) {
+                            if (!record.InstASM.empty() || record.JumpInstNum > 0) {
+                                std::cerr << "objdump instruction without function" << std::endl;
+                            }
+                            break;
+                        }
+                        function->InstASM.insert(function->InstASM.end(), record.InstASM.begin(),
+                                                 record.InstASM.end());
+                        function->CallInstNum += record.InstASM.size();
+                        function->JumpInstNum += record.JumpInstNum;
+                        break;
+                    }
+                    case ObjdumpKind::objdump_empty: {
+                        // need add a space line at the end of objdump file.
+                        if (InsNum > 0 && !FunctionName.empty()) {
+                            function->InstNum = InsNum;
+                            InsNum = 0;
+                            FunctionName = "";
+                        }
+                        break;
+                    }
+                }
+            }
+            std::vector<ObjdumpRecord>().swap(records);
+        }
+    }
+
+    void dra::DModule::ReadObjdumpSerial(const std::string &objdump) {
         std::string Line;
         std::string Addr;
         std::string FunctionName;
@@ -109,13 +327,7 @@ namespace dra {
         std::cout << "objdump :" << objdump << std::endl;
 #endif
 
-        std::string obj = objdump.substr(0, objdump.find(".objdump"));
-        std::string output_file = obj + ".bin";
-        std::fstream input(output_file, std::ios::in | std::ios::binary);
-        if (!this->addr2line->ParseFromIstream(&input)) {
-            std::cerr << "Failed to parse addr2line." << std::endl;
-        }
-        input.close();
+        this->ReadAddr2line(objdump);
 
         std::ifstream objdumpFile(objdump);
         InsNum = 0;
@@ -205,7 +417,7 @@ namespace dra {
 
                             if (Inst.at(0) == 'c' && Inst.find("call") < Inst.size()) {
 
-                                auto *inst = new DAInstruction();
+                                auto *inst = this->InstASMArena.create();
                                 inst->setAddr(Addr);
                                 inst->OInst = Inst;
                                 if (Inst.find("__sanitizer_cov_trace_pc") < Inst.size()) {
@@ -241,7 +453,313 @@ namespace dra {
         }
     }
 
-    void dra::DModule::ReadAsmSourceCode(std::string AssemblySourceCode) {
+    namespace {
+        // the parts of one built-in.s shard which matter for the merge, in file order.
+        // text and name point into the mapped file.
+        enum AsmKind {
+            asm_path, asm_basicblock, asm_call, asm_inst, asm_func_end,
+        };
+
+        struct AsmEvent {
+            AsmKind kind;
+            // for inst: number of other instructions and of non call instructions starting with 'c'
+            unsigned int number;
+            unsigned int c_number;
+            llvm::StringRef text;
+            llvm::StringRef name;
+
+            AsmEvent(AsmKind kind, llvm::StringRef text) : kind(kind), number(0), c_number(0), text(text) {}
+        };
+
+        // events of one shard which belong to the same function, with the parser state at the first event
+        struct AsmRun {
+            DFunction *function;
+            uint64_t shard;
+            size_t begin;
+            size_t end;
+            unsigned int InstNum;
+            unsigned int CallInstNum;
+            llvm::StringRef BasicBlockName;
+        };
+
+        bool isAsmFunctionHeader(llvm::StringRef line) {
+            if (line.empty()) {
+                return false;
+            }
+            switch (line[0]) {
+                case '.':
+                case '#':
+                case '\t':
+                case ' ':
+                    return false;
+                default:
+                    return line.find(':') != llvm::StringRef::npos && line.find("# @") != llvm::StringRef::npos;
+            }
+        }
+
+        // same rules as ReadAsmSourceCodeSerial, but only records what the line means
+        void tokenizeAsm(llvm::StringRef file, size_t start, size_t stop, std::vector<AsmEvent> &events) {
+            llvm::StringRef Path;
+            llvm::StringRef FunctionName;
+            size_t pos = start;
+            while (pos < stop) {
+                size_t end = file.find('\n', pos);
+                if (end > stop) {
+                    end = stop;
+                }
+                llvm::StringRef line = file.slice(pos, end);
+                pos = end + 1;
+                if (line.empty()) {
+                    continue;
+                }
+                switch (line[0]) {
+                    case '.': {
+                        if (line.find(".Lfunc_end") != llvm::StringRef::npos) {
+                            events.emplace_back(AsmKind::asm_func_end, llvm::StringRef());
+                        } else if (line.find("# %") != llvm::StringRef::npos) {
+                            events.emplace_back(AsmKind::asm_basicblock, line.substr(line.find('%') + 1));
+                        }
+                        break;
+                    }
+                    case '#': {
+                        if (line.find("# %") != llvm::StringRef::npos) {
+                            size_t second = line.find('%', line.find('%') + 1);
+                            if (second != llvm::StringRef::npos) {
+                                events.emplace_back(AsmKind::asm_basicblock, line.substr(second + 1));
+                            }
+                        }
+                        break;
+                    }
+                    case '\t': {
+                        if (line.size() == 1) {
+
+                        } else if (line[1] == '.') {
+                            //get path
+                            if (Path.empty() && !FunctionName.empty() && line.find('#') != llvm::StringRef::npos) {
+                                Path = line.slice(line.find('#') + 2, line.find(':'));
+                                events.emplace_back(AsmKind::asm_path, Path);
+                                events.back().name = FunctionName;
+                            }
+                        } else if (line[1] >= 'a' && line[1] <= 'z') {
+                            llvm::StringRef Inst = line.drop_front(1);
+                            if (Inst[0] == 'c' && Inst.find("call") != llvm::StringRef::npos) {
+                                events.emplace_back(AsmKind::asm_call, Inst);
+                            } else {
+                                if (events.empty() || events.back().kind != AsmKind::asm_inst) {
+                                    events.emplace_back(AsmKind::asm_inst, llvm::StringRef());
+                                }
+                                if (Inst[0] == 'c') {
+                                    events.back().c_number++;
+                                } else {
+                                    events.back().number++;
+                                }
+                            }
+                        }
+                        break;
+                    }
+                    case ' ': {
+                        //comment
+                        break;
+                    }
+                    default: {
+                        if (isAsmFunctionHeader(line)) {
+                            FunctionName = line.substr(0, line.find(':'));
+                            Path = llvm::StringRef();
+                        }
+                    }
+                }
+            }
+        }
+
+        // apply the events of one run to its function, runs of one function are applied in file order
+        void applyAsmRun(const AsmRun &run, const std::vector<AsmEvent> &events, DArena<DBasicBlock> &arena) {
+            DFunction *function = run.function;
+            unsigned int InstNum = run.InstNum;
+            unsigned int CallInstNum = run.CallInstNum;
+            std::string BasicBlockName = run.BasicBlockName.str();
+            DBasicBlock *block = function->get_DB_from_name(BasicBlockName);
+            for (size_t i = run.begin; i < run.end; i++) {
+                const AsmEvent &event = events[i];
+                switch (event.kind) {
+                    case AsmKind::asm_path: {
+                        break;
+                    }
+                    case AsmKind::asm_basicblock: {
+                        BasicBlockName = event.text.str();
+                        auto &b = function->BasicBlock[DSymbol::intern(event.text)];
+                        if (b == nullptr) {
+                            b = arena.create();
+                            b->name = BasicBlockName;
+                        }
+                        b->setAsmSourceCode(true);
+                        block = b;
+                        break;
+                    }
+                    case AsmKind::asm_call: {
+                        if (CallInstNum < function->InstASM.size()) {
+                            auto *inst = function->InstASM.at(CallInstNum);
+                            inst->SInst = event.text.str();
+                            inst->BasicBlockName = BasicBlockName;
+                            if (block != nullptr) {
+                                inst->parent = block;
+                                block->InstASM.push_back(inst);
+                                if (event.text.find("__sanitizer_cov_trace") != llvm::StringRef::npos) {
+                                    if (event.text.find("_pc") != llvm::StringRef::npos) {
+                                        block->trace_pc_address = inst->address;
+                                    }
+                                    block->tracr_num++;
+                                }
+                            } else {
+                                std::cerr << "error basic block name : " << BasicBlockName << std::endl;
+                                std::cerr << "function name : " << function->FunctionName << std::endl;
+                            }
+                            CallInstNum++;
+                        }
+                        InstNum++;
+                        break;
+                    }
+                    case AsmKind::asm_inst: {
+                        if (CallInstNum < function->InstASM.size()) {
+                            function->JumpInstNum += event.c_number;
+                        }
+                        InstNum += event.number + event.c_number;
+                        break;
+                    }
+                    case AsmKind::asm_func_end: {
+                        function->InstNum = InstNum;
+                        InstNum = 0;
+                        CallInstNum = 0;
+                        break;
+                    }
+                }
+            }
+        }
+    } /* namespace */
+
+    void DModule::ReadAsmSourceCode(std::string AssemblySourceCode) {
+        if (this->NumberThread <= 1) {
+            this->ReadAsmSourceCodeSerial(AssemblySourceCode);
+            return;
+        }
+#if DEBUG_ASM
+        std::cout << "*************************************************" << std::endl;
+        std::cout << "****************ReadAsmSourceCode****************" << std::endl;
+        std::cout << "AssemblySourceCode :" << AssemblySourceCode << std::endl;
+#endif
+        auto buffer = dra::mapFile(AssemblySourceCode);
+        if (!buffer) {
+            std::cerr << "Unable to open AssemblySourceCodeFile " << AssemblySourceCode << ">\n";
+            return;
+        }
+        llvm::StringRef file = (*buffer)->getBuffer();
+
+        // shards of about 4MB, every shard except the first one starts with a function header
+        const size_t shard_size = 4 << 20;
+        std::vector<size_t> boundary;
+        boundary.push_back(0);
+        for (size_t pos = shard_size; pos < file.size(); pos = boundary.back() + shard_size) {
+            pos = file.find('\n', pos);
+            while (pos != llvm::StringRef::npos) {
+                pos++;
+                size_t end = file.find('\n', pos);
+                if (isAsmFunctionHeader(file.slice(pos, end))) {
+                    break;
+                }
+                pos = end;
+            }
+            if (pos == llvm::StringRef::npos) {
+                break;
+            }
+            boundary.push_back(pos);
+        }
+        boundary.push_back(file.size());
+        uint64_t number = boundary.size() - 1;
+
+        // parser state carried from one shard to the next
+        DFunction *function = nullptr;
+        unsigned int InstNum = 0;
+        unsigned int CallInstNum = 0;
+        llvm::StringRef BasicBlockName;
+
+        // shards are handled in waves to bound the memory used by the events
+        uint64_t wave = this->NumberThread * 4;
+        for (uint64_t first = 0; first < number; first += wave) {
+            uint64_t last = std::min(first + wave, number);
+            std::vector<std::vector<AsmEvent>> events(last - first);
+            dra::parallel_for(last - first, this->NumberThread, [&](uint64_t i) {
+                tokenizeAsm(file, boundary[first + i], boundary[first + i + 1], events[i]);
+            });
+
+            // bind functions in file order and record the parser state at the start of every run
+            std::vector<AsmRun> runs;
+            for (uint64_t i = 0; i < events.size(); i++) {
+                for (size_t j = 0; j < events[i].size(); j++) {
+                    const AsmEvent &event = events[i][j];
+                    if (event.kind == AsmKind::asm_path) {
+                        function = CheckRepeatFunction(event.text.str(), event.name.str(), dra::FunctionKind::S);
+                    }
+                    if (function == nullptr) {
+                        continue;
+                    }
+                    if (event.kind == AsmKind::asm_path || runs.empty() || runs.back().shard != i) {
+                        if (!runs.empty() && runs.back().shard == i) {
+                            runs.back().end = j;
+                        }
+                        runs.push_back(AsmRun{function, i, j, events[i].size(), InstNum, CallInstNum, BasicBlockName});
+                    }
+                    switch (event.kind) {
+                        case AsmKind::asm_basicblock: {
+                            BasicBlockName = event.text;
+                            break;
+                        }
+                        case AsmKind::asm_call: {
+                            if (CallInstNum < function->InstASM.size()) {
+                                CallInstNum++;
+                            }
+                            InstNum++;
+                            break;
+                        }
+                        case AsmKind::asm_inst: {
+                            InstNum += event.number + event.c_number;
+                            break;
+                        }
+                        case AsmKind::asm_func_end: {
+                            InstNum = 0;
+                            CallInstNum = 0;
+                            break;
+                        }
+                        default: {
+                        }
+                    }
+                }
+            }
+
+            // runs of different functions touch disjoint objects
+            std::vector<DFunction *> order;
+            std::unordered_map<DFunction *, std::vector<AsmRun *>> group;
+            for (auto &run : runs) {
+                auto &g = group[run.function];
+                if (g.empty()) {
+                    order.push_back(run.function);
+                }
+                g.push_back(&run);
+            }
+            std::vector<DArena<DBasicBlock>> arenas(order.size());
+            dra::parallel_for(order.size(), this->NumberThread, [&](uint64_t i) {
+                for (auto *run : group.find(order[i])->second) {
+                    applyAsmRun(*run, events[run->shard], arenas[i]);
+                }
+            });
+            for (auto &arena : arenas) {
+                this->BasicBlockArena.merge(arena);
+            }
+        }
+#if DEBUG_ASM
+        std::cout << "****************ReadAsmSourceCode****************" << std::endl;
+#endif
+    }
+
+    void dra::DModule::ReadAsmSourceCodeSerial(std::string AssemblySourceCode) {
         std::string line;
         std::string Path;
         std::string FunctionName;
@@ -321,13 +839,13 @@ namespace dra {
                                     ss << line.at(i);
                                 }
                                 BasicBlockName = ss.str();
-                                if (function->BasicBlock.find(BasicBlockName) != function->BasicBlock.end()) {
-                                } else {
-                                    function->BasicBlock[BasicBlockName] = new DBasicBlock();
-                                    (function->BasicBlock[BasicBlockName])->name = BasicBlockName;
+                                auto &b = function->BasicBlock[DSymbol::intern(BasicBlockName)];
+                                if (b == nullptr) {
+                                    b = this->BasicBlockArena.create();
+                                    b->name = BasicBlockName;
                                 }
 
-                                (function->BasicBlock[BasicBlockName])->setAsmSourceCode(true);
+                                b->setAsmSourceCode(true);
 
 #if DEBUG_ASM
                                 std::cout << ". bb name :" << ss.str() << std::endl;
@@ -350,12 +868,12 @@ namespace dra {
                                         }
                                         BasicBlockName = ss.str();
 
-                                        if (function->BasicBlock.find(BasicBlockName) != function->BasicBlock.end()) {
-                                        } else {
-                                            function->BasicBlock[BasicBlockName] = new DBasicBlock();
-                                            (function->BasicBlock[BasicBlockName])->name = BasicBlockName;
+                                        auto &b = function->BasicBlock[DSymbol::intern(BasicBlockName)];
+                                        if (b == nullptr) {
+                                            b = this->BasicBlockArena.create();
+                                            b->name = BasicBlockName;
                                         }
-                                        (function->BasicBlock[BasicBlockName])->setAsmSourceCode(true);
+                                        b->setAsmSourceCode(true);
                                         break;
                                     }
                                 }
@@ -416,17 +934,17 @@ namespace dra {
                                             auto *inst = function->InstASM.at(CallInstNum);
                                             inst->SInst = Inst;
                                             inst->BasicBlockName = BasicBlockName;
-                                            if (function->BasicBlock.find(BasicBlockName) !=
-                                                function->BasicBlock.end()) {
-                                                inst->parent = function->BasicBlock[BasicBlockName];
-                                                function->BasicBlock[BasicBlockName]->InstASM.push_back(inst);
+                                            auto *block = function->get_DB_from_name(BasicBlockName);
+                                            if (block != nullptr) {
+                                                inst->parent = block;
+                                                block->InstASM.push_back(inst);
                                                 if (Inst.find("__sanitizer_cov_trace") <= Inst.size()) {
                                                     if (Inst.find("_pc") <= Inst.size()) {
-                                                        (function->BasicBlock[BasicBlockName])->trace_pc_address = inst->address;
+                                                        block->trace_pc_address = inst->address;
                                                     } else if (Inst.find("_cmp") <= Inst.size()) {
 
                                                     }
-                                                    (function->BasicBlock[BasicBlockName])->tracr_num++;
+                                                    block->tracr_num++;
                                                     trace_num++;
 #if DEBUG_ASM
                                                     std::cout << "o inst :" << inst->OInst << std::endl;
@@ -498,8 +1016,8 @@ namespace dra {
                     break;
                 }
                 case dra::FunctionKind::S: {
-                    RepeatSFunction[function->Path].insert(
-                            std::pair<std::string, DFunction *>(function->FunctionName, function));
+                    RepeatSFunction[DSymbol::intern(function->Path)].insert(
+                            std::pair<uint32_t, DFunction *>(DSymbol::intern(function->FunctionName), function));
                     //maybe they are same
                     break;
                 }
@@ -519,9 +1037,8 @@ namespace dra {
 //            std::cerr << "kind : " << kind << std::endl;
 //        }
 
-        DFunction *function;
-        if ((Function.find(Path) != Function.end()) && (Function[Path].find(FunctionName) != Function[Path].end())) {
-            function = Function[Path][FunctionName];
+        DFunction *function = get_DF_from_name(Path, FunctionName);
+        if (function != nullptr) {
             switch (kind) {
                 case dra::FunctionKind::IR: {
                     if (function->isIR()) {
@@ -578,8 +1095,9 @@ namespace dra {
 
     DFunction *DModule::CreatFunction(std::string Path, std::string FunctionName, FunctionKind kind) {
         DFunction *function;
-        function = new DFunction();
-        Function[Path].insert(std::pair<std::string, DFunction *>(FunctionName, function));
+        function = this->FunctionArena.create();
+        AllFunction.push_back(function);
+        Function[DSymbol::intern(Path)].insert(std::pair<uint32_t, DFunction *>(DSymbol::intern(FunctionName), function));
         function->FunctionName = FunctionName;
         function->Path = Path;
         function->setKind(kind);
@@ -590,48 +1108,65 @@ namespace dra {
         if (f == nullptr) {
             return nullptr;
         }
-        std::string Path = dra::getFileName(f);
-        std::string FunctionName = dra::getFunctionName(f);
-        if (this->Function.find(Path) != this->Function.end()) {
-            auto p = this->Function[Path];
-            if (p.find(FunctionName) != p.end()) {
-                auto f = p[FunctionName];
-                return f;
-            } else {
-#if DEBUG_ERR
-                std::cerr << "get_DF_from_bb can not find FunctionName : " << FunctionName << std::endl;
-#endif
-            }
+        DFunction *df;
+        auto it = this->FunctionOf.find(f);
+        if (it != this->FunctionOf.end()) {
+            df = it->second;
+        } else {
+            // only a lazily read bit code has functions which are not indexed yet, and its queries are serialized.
+            // the debug information of a function is part of its body.
+            materialize(f);
+            df = get_DF_from_name(dra::getFileName(f), dra::getFunctionName(f));
+            this->FunctionOf[f] = df;
+        }
+        if (df != nullptr) {
+            df->materialize();
         } else {
 #if DEBUG_ERR
-            std::cerr << "get_DF_from_f can not find Path : " << Path << std::endl;
+            std::cerr << "get_DF_from_f can not find : " << dra::getFileName(f) << " " << dra::getFunctionName(f)
+                      << std::endl;
 #endif
         }
-        return nullptr;
+        return df;
+    }
+
+    DFunction *DModule::get_DF_from_name(llvm::StringRef Path, llvm::StringRef FunctionName) const {
+        // a name which was never interned can not be a key
+        uint32_t path = DSymbol::lookup(Path);
+        uint32_t name = DSymbol::lookup(FunctionName);
+        if (path == DSymbol::None || name == DSymbol::None) {
+            return nullptr;
+        }
+        auto p = this->Function.find(path);
+        if (p == this->Function.end()) {
+            return nullptr;
+        }
+        auto f = p->second.find(name);
+        if (f == p->second.end()) {
+            return nullptr;
+        }
+        return f->second;
     }
 
     DBasicBlock *DModule::get_DB_from_bb(llvm::BasicBlock *b) {
         llvm::BasicBlock *bb = dra::getRealBB(b);
-        std::string Path = dra::getFileName(bb->getParent());
-        std::string FunctionName = dra::getFunctionName(bb->getParent());
-        std::string bbname = bb->getName().str();
-        if (this->Function.find(Path) != this->Function.end()) {
-            auto p = this->Function[Path];
-            if (p.find(FunctionName) != p.end()) {
-                auto f = p[FunctionName];
-                if (f->BasicBlock.find(bbname) != f->BasicBlock.end()) {
-                    DBasicBlock *db = f->BasicBlock[bbname];
-                    return db;
-                } else {
-                    std::cerr << "get_DB_from_bb can not find bbname : " << bbname << std::endl;
-                }
-            } else {
-                std::cerr << "get_DB_from_bb can not find FunctionName : " << FunctionName << std::endl;
-            }
-        } else {
-            std::cerr << "get_DB_from_bb can not find Path : " << Path << std::endl;
+        // materializing the function fills in the blocks of its body
+        DFunction *f = get_DF_from_f(bb->getParent());
+        if (f == nullptr) {
+            std::cerr << "get_DB_from_bb can not find : " << dra::getFileName(bb->getParent()) << " "
+                      << dra::getFunctionName(bb->getParent()) << std::endl;
+            return nullptr;
+        }
+        auto it = this->BasicBlockOf.find(bb);
+        if (it != this->BasicBlockOf.end()) {
+            return it->second;
+        }
+        // the block of a repeat which is not materialized yet
+        DBasicBlock *db = f->get_DB_from_name(bb->getName());
+        if (db == nullptr) {
+            std::cerr << "get_DB_from_bb can not find bbname : " << bb->getName().str() << std::endl;
         }
-        return nullptr;
+        return db;
     }
 
     DBasicBlock *DModule::get_DB_from_i(llvm::Instruction *i) {
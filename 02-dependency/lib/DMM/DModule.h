@@ -8,11 +8,14 @@
 #ifndef LIB_DRA_MODULEALL_H_
 #define LIB_DRA_MODULEALL_H_
 
+#include <llvm/ADT/DenseMap.h>
 #include <memory>
 #include <string>
 #include <unordered_map>
 
+#include "DArena.h"
 #include "DFunction.h"
+#include "DNumbering.h"
 
 namespace dra {
     class address;
@@ -26,6 +29,7 @@ namespace dra {
 
 namespace llvm {
     class Module;
+    class Function;
 } /* namespace llvm */
 
 namespace dra {
@@ -38,14 +42,26 @@ namespace dra {
 
         std::string exec(std::string cmd);
 
+        void ReadAddr2line(const std::string &objdump);
+
         void ReadObjdump(const std::string& objdump);
 
+        void ReadObjdumpSerial(const std::string &objdump);
+
         void ReadAsmSourceCode(std::string AssemblySourceCode);
 
+        void ReadAsmSourceCodeSerial(std::string AssemblySourceCode);
+
         void ReadBC(const std::string& InputFilename);
 
         void BuildLLVMFunction(llvm::Module *Module);
 
+        // load the body of one function if the bit code is read lazily
+        void materialize(llvm::Function *f);
+
+        // load all bodies and build the IR functions, used when there is no snapshot to build them from
+        void materializeAll();
+
         void AddRepeatFunction(DFunction *function, FunctionKind kind);
 
         DFunction *CheckRepeatFunction(std::string Path, std::string FunctionName, FunctionKind kind);
@@ -54,6 +70,8 @@ namespace dra {
 
         DFunction *get_DF_from_f(llvm::Function *b);
 
+        DFunction *get_DF_from_name(llvm::StringRef Path, llvm::StringRef FunctionName) const;
+
         DBasicBlock *get_DB_from_bb(llvm::BasicBlock *b);
 
         DBasicBlock *get_DB_from_i(llvm::Instruction *i);
@@ -64,19 +82,42 @@ namespace dra {
 
     public:
         std::unique_ptr<llvm::Module> module;
-        std::unordered_map<std::string, std::unordered_map<std::string, DFunction *>> Function;
+
+        // the DMM objects of this module, freed together with it
+        DArena<DFunction> FunctionArena;
+        DArena<DBasicBlock> BasicBlockArena;
+        DArena<DAInstruction> InstASMArena;
+        DArena<DLInstruction> InstIRArena;
+
+        // path -> function name -> function, both keyed by their DSymbol id
+        std::unordered_map<uint32_t, std::unordered_map<uint32_t, DFunction *>> Function;
+        // all functions in creation order, including the repeat ones
+        std::vector<DFunction *> AllFunction;
+        // the function and the basic block each IR function and named block resolves to by its names,
+        // filled when the functions are built, so the queries do not rebuild and look up the names
+        llvm::DenseMap<const llvm::Function *, DFunction *> FunctionOf;
+        llvm::DenseMap<const llvm::BasicBlock *, DBasicBlock *> BasicBlockOf;
         std::unique_ptr<dra::address> addr2line;
 
         uint32_t NumberBasicBlock;
         uint32_t NumberBasicBlockReal;
         uint32_t NumberBasicBlockCovered;
 
+        // number of threads used by the parsers, 1 means the serial parsers
+        uint32_t NumberThread;
+
+        // read the bit code with getLazyIRFileModule, the function bodies are loaded on first use
+        bool Lazy;
+
         std::unordered_map<std::string, DFunction *> RepeatBCFunction;
         std::unordered_map<std::string, DFunction *> RepeatOFunction;
-        std::unordered_map<std::string, std::unordered_map<std::string, DFunction *>> RepeatSFunction;
+        std::unordered_map<uint32_t, std::unordered_map<uint32_t, DFunction *>> RepeatSFunction;
 
         std::unordered_map<llvm::FunctionType *, std::set<llvm::Function *>> Ft;
 
+        // ordinals of the basic blocks and instructions of the bit code, for the static analysis results
+        DNumbering Numbering;
+
     };
 
 } /* namespace dra */
@@ -0,0 +1,137 @@
+/*
+ * DNumbering.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "DNumbering.h"
+
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Instruction.h>
+#include <llvm/IR/Module.h>
+
+namespace dra {
+
+    const uint32_t DNumbering::None = UINT32_MAX;
+
+    DNumbering::DNumbering() : NumberSlot(0) {}
+
+    DNumbering::~DNumbering() {
+        for (uint32_t i = 0; i < this->NumberSlot; i++) {
+            delete this->Numbered[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    void DNumbering::index(const llvm::Module &m) {
+        this->Slot.clear();
+        this->Slot.reserve(m.size());
+        for (auto &f : m) {
+            this->Slot.insert(std::make_pair(&f, (uint32_t) this->Slot.size()));
+        }
+        this->NumberSlot = this->Slot.size();
+        this->Numbered.reset(new std::atomic<FunctionNumbering *>[this->NumberSlot]);
+        for (uint32_t i = 0; i < this->NumberSlot; i++) {
+            this->Numbered[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    const DNumbering::FunctionNumbering *DNumbering::number(const llvm::Function *f) {
+        if (f == nullptr) {
+            return nullptr;
+        }
+        auto s = this->Slot.find(f);
+        if (s == this->Slot.end()) {
+            return nullptr;
+        }
+        auto &slot = this->Numbered[s->second];
+        FunctionNumbering *n = slot.load(std::memory_order_acquire);
+        if (n != nullptr) {
+            return n;
+        }
+        // a body which is loaded later would get other ordinals
+        if (f->isMaterializable()) {
+            return nullptr;
+        }
+        auto *fresh = new FunctionNumbering();
+        fresh->Blocks.reserve(f->size());
+        fresh->First.reserve(f->size() + 1);
+        for (auto &b : *f) {
+            fresh->BlockOrdinal[&b] = fresh->Blocks.size();
+            fresh->Blocks.push_back(const_cast<llvm::BasicBlock *>(&b));
+            fresh->First.push_back(fresh->Insts.size());
+            if (b.hasName()) {
+                fresh->Named.insert(std::make_pair(b.getName(), const_cast<llvm::BasicBlock *>(&b)));
+            }
+            uint32_t no = 0;
+            for (auto &i : b) {
+                fresh->InstOrdinal[&i] = no++;
+                fresh->Insts.push_back(const_cast<llvm::Instruction *>(&i));
+            }
+        }
+        fresh->First.push_back(fresh->Insts.size());
+        // two threads may number the same function, the first one to publish wins
+        if (slot.compare_exchange_strong(n, fresh, std::memory_order_acq_rel)) {
+            return fresh;
+        }
+        delete fresh;
+        return n;
+    }
+
+    uint32_t DNumbering::getOrdinal(const llvm::BasicBlock *b) {
+        if (b == nullptr) {
+            return None;
+        }
+        auto *n = number(b->getParent());
+        if (n == nullptr) {
+            return None;
+        }
+        auto it = n->BlockOrdinal.find(b);
+        return it == n->BlockOrdinal.end() ? None : it->second;
+    }
+
+    uint32_t DNumbering::getOrdinal(const llvm::Instruction *i) {
+        if (i == nullptr || i->getParent() == nullptr) {
+            return None;
+        }
+        auto *n = number(i->getParent()->getParent());
+        if (n == nullptr) {
+            return None;
+        }
+        auto it = n->InstOrdinal.find(i);
+        return it == n->InstOrdinal.end() ? None : it->second;
+    }
+
+    llvm::BasicBlock *DNumbering::getBasicBlock(const llvm::Function *f, uint32_t ordinal) {
+        auto *n = number(f);
+        if (n == nullptr || ordinal >= n->Blocks.size()) {
+            return nullptr;
+        }
+        return n->Blocks[ordinal];
+    }
+
+    llvm::BasicBlock *DNumbering::getBasicBlock(const llvm::Function *f, llvm::StringRef name) {
+        auto *n = number(f);
+        if (n == nullptr) {
+            return nullptr;
+        }
+        auto it = n->Named.find(name);
+        return it == n->Named.end() ? nullptr : it->second;
+    }
+
+    llvm::Instruction *DNumbering::getInstruction(const llvm::BasicBlock *b, uint32_t ordinal) {
+        if (b == nullptr) {
+            return nullptr;
+        }
+        auto *n = number(b->getParent());
+        if (n == nullptr) {
+            return nullptr;
+        }
+        auto it = n->BlockOrdinal.find(b);
+        if (it == n->BlockOrdinal.end() || ordinal >= n->First[it->second + 1] - n->First[it->second]) {
+            return nullptr;
+        }
+        return n->Insts[n->First[it->second] + ordinal];
+    }
+
+} /* namespace dra */
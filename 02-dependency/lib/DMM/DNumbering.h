@@ -0,0 +1,78 @@
+/*
+ * DNumbering.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef LIB_DRA_DNUMBERING_H_
+#define LIB_DRA_DNUMBERING_H_
+
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/StringRef.h>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace llvm {
+    class BasicBlock;
+    class Function;
+    class Instruction;
+    class Module;
+} /* namespace llvm */
+
+namespace dra {
+
+    // positional ids used by the static analysis: the ordinal of a basic block in its function
+    // and the ordinal of an instruction in its basic block.
+    // a function is numbered in one pass the first time one of its values is asked for,
+    // then both directions are a lookup in its side arrays. each function has a slot from index, where its
+    // numbering is published once, so the lookups take no lock and are safe to use from several threads.
+    class DNumbering {
+    public:
+        static const uint32_t None;
+
+        DNumbering();
+
+        virtual ~DNumbering();
+
+        // give every function of m a slot, once the bit code is read and before the first lookup
+        void index(const llvm::Module &m);
+
+        uint32_t getOrdinal(const llvm::BasicBlock *b);
+
+        uint32_t getOrdinal(const llvm::Instruction *i);
+
+        llvm::BasicBlock *getBasicBlock(const llvm::Function *f, uint32_t ordinal);
+
+        // the named basic block of f, nullptr if there is none
+        llvm::BasicBlock *getBasicBlock(const llvm::Function *f, llvm::StringRef name);
+
+        llvm::Instruction *getInstruction(const llvm::BasicBlock *b, uint32_t ordinal);
+
+    private:
+        struct FunctionNumbering {
+            std::vector<llvm::BasicBlock *> Blocks;
+            // the instructions of block k are Insts[First[k]] ... Insts[First[k + 1] - 1]
+            std::vector<uint32_t> First;
+            std::vector<llvm::Instruction *> Insts;
+            llvm::DenseMap<const llvm::BasicBlock *, uint32_t> BlockOrdinal;
+            // the ordinal in its basic block
+            llvm::DenseMap<const llvm::Instruction *, uint32_t> InstOrdinal;
+            // the names point into the blocks, which live as long as the module
+            llvm::DenseMap<llvm::StringRef, llvm::BasicBlock *> Named;
+        };
+
+        // nullptr if the body of f is not loaded
+        const FunctionNumbering *number(const llvm::Function *f);
+
+        // not changed after index
+        llvm::DenseMap<const llvm::Function *, uint32_t> Slot;
+        // the numbering of a function is not changed after it is published
+        std::unique_ptr<std::atomic<FunctionNumbering *>[]> Numbered;
+        uint32_t NumberSlot;
+    };
+
+} /* namespace dra */
+
+#endif /* LIB_DRA_DNUMBERING_H_ */
@@ -0,0 +1,594 @@
+/*
+ * DSnapshot.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "DSnapshot.h"
+
+#include <llvm/ADT/StringMap.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/xxhash.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+#include "DataManagement.h"
+#include "../DCC/general.h"
+#include "DSymbol.h"
+
+namespace dra {
+
+    const uint64_t DSnapshot::Magic = 0x50414e5341524430; // "0DRASNAP"
+    const uint32_t DSnapshot::Version = 1;
+
+    namespace {
+        enum SnapshotFlag {
+            snapshot_objdump = 1, snapshot_asm = 2, snapshot_ir = 4, snapshot_repeat = 8, snapshot_parent = 16,
+        };
+
+        class SnapshotWriter {
+        public:
+            void put32(uint32_t v) {
+                body.append(reinterpret_cast<const char *>(&v), sizeof(v));
+            }
+
+            void put64(uint64_t v) {
+                body.append(reinterpret_cast<const char *>(&v), sizeof(v));
+            }
+
+            void putString(llvm::StringRef s) {
+                auto it = ids.insert(std::make_pair(s, (uint32_t) strings.size()));
+                if (it.second) {
+                    strings.push_back(it.first->getKey());
+                }
+                put32(it.first->getValue());
+            }
+
+        public:
+            std::string body;
+            llvm::StringMap<uint32_t> ids;
+            std::vector<llvm::StringRef> strings;
+        };
+
+        class SnapshotReader {
+        public:
+            explicit SnapshotReader(llvm::StringRef buffer) : p(buffer.begin()), end(buffer.end()), fail(false) {}
+
+            uint32_t get32() {
+                uint32_t v = 0;
+                get(&v, sizeof(v));
+                return v;
+            }
+
+            uint64_t get64() {
+                uint64_t v = 0;
+                get(&v, sizeof(v));
+                return v;
+            }
+
+            llvm::StringRef getBytes(uint32_t size) {
+                if ((uint64_t) (end - p) < size) {
+                    fail = true;
+                    return llvm::StringRef();
+                }
+                llvm::StringRef s(p, size);
+                p += size;
+                return s;
+            }
+
+            llvm::StringRef getString() {
+                uint32_t id = getStringId();
+                return fail ? llvm::StringRef() : strings[id];
+            }
+
+            // the id of a string of the string table, 0 if it is out of range
+            uint32_t getStringId() {
+                uint32_t id = get32();
+                if (id >= strings.size()) {
+                    fail = true;
+                    return 0;
+                }
+                return id;
+            }
+
+            // false if less than number entries of size bytes are left, so a broken count is not allocated
+            bool fits(uint64_t number, uint64_t size) {
+                if (number > (uint64_t) (end - p) / size) {
+                    fail = true;
+                }
+                return !fail;
+            }
+
+        private:
+            void get(void *v, size_t size) {
+                if ((size_t) (end - p) < size) {
+                    fail = true;
+                    return;
+                }
+                memcpy(v, p, size);
+                p += size;
+            }
+
+        public:
+            const char *p;
+            const char *end;
+            bool fail;
+            std::vector<llvm::StringRef> strings;
+        };
+
+        // the snapshot is decoded into these tables first, the module is only changed once all of it is valid.
+        // strings are ids of the string table.
+        struct SnapshotInstruction {
+            uint32_t Address;
+            uint32_t OInst;
+            uint32_t SInst;
+            uint32_t BasicBlockName;
+            uint64_t address;
+        };
+
+        struct SnapshotBasicBlock {
+            uint32_t name;
+            uint32_t flag;
+            uint64_t trace_pc_address;
+            uint64_t trace_cmp_address;
+            uint64_t tracr_num;
+            std::vector<uint32_t> InstASM;
+        };
+
+        struct SnapshotFunction {
+            uint32_t Address;
+            uint32_t flag;
+            uint32_t InstNum;
+            uint32_t CallInstNum;
+            uint32_t JumpInstNum;
+            uint32_t NumberBasicBlock;
+            uint32_t NumberBasicBlockReal;
+            std::vector<SnapshotInstruction> InstASM;
+            std::vector<SnapshotBasicBlock> BasicBlock;
+        };
+
+        struct SnapshotAddress {
+            uint64_t address;
+            uint32_t function;
+            uint32_t index;
+        };
+
+        // path -> name -> function id, as DModule::Function and DModule::RepeatSFunction, by string id
+        typedef std::unordered_map<uint32_t, std::unordered_map<uint32_t, uint32_t>> SnapshotFunctionTable;
+    } /* namespace */
+
+    DSnapshot::DSnapshot(const std::string &objdump, const std::string &AssemblySourceCode,
+                         const std::string &bit_code, uint32_t thread) {
+        std::string obj = objdump.substr(0, objdump.find(".objdump"));
+        this->Path = obj + ".snapshot";
+        this->Key[0] = hashFile(objdump, thread);
+        this->Key[1] = hashFile(AssemblySourceCode, thread);
+        this->Key[2] = hashFile(bit_code, thread);
+        this->Key[3] = hashFile(obj + ".bin", thread);
+    }
+
+    DSnapshot::~DSnapshot() = default;
+
+    uint64_t DSnapshot::hashFile(const std::string &path, uint32_t thread) {
+        auto buffer = dra::mapFile(path);
+        if (!buffer) {
+            return 0;
+        }
+        llvm::StringRef file = (*buffer)->getBuffer();
+        // hash 64MB blocks in parallel, then hash the block hashes
+        const uint64_t block = 64 << 20;
+        std::vector<uint64_t> hash((file.size() + block - 1) / block + 1);
+        hash.back() = file.size();
+        dra::parallel_for(hash.size() - 1, thread, [&](uint64_t i) {
+            hash[i] = llvm::xxHash64(file.substr(i * block, block));
+        });
+        return llvm::xxHash64(
+                llvm::StringRef(reinterpret_cast<const char *>(hash.data()), hash.size() * sizeof(uint64_t)));
+    }
+
+    bool DSnapshot::write(DataManagement *DM) {
+        DModule *M = DM->Modules;
+        SnapshotWriter w;
+
+        std::unordered_map<DFunction *, uint32_t> function_id;
+        std::unordered_map<DAInstruction *, std::pair<uint32_t, uint32_t>> inst_id;
+        for (uint32_t i = 0; i < M->AllFunction.size(); i++) {
+            function_id[M->AllFunction[i]] = i;
+        }
+
+        // identity of the functions, checked against the functions of ReadBC before anything is changed
+        w.put32(M->AllFunction.size());
+        for (auto *f : M->AllFunction) {
+            w.putString(f->Path);
+            w.putString(f->FunctionName);
+            w.putString(f->IRName);
+        }
+
+        for (uint32_t i = 0; i < M->AllFunction.size(); i++) {
+            DFunction *f = M->AllFunction[i];
+            w.putString(f->Address);
+            w.put32((f->isObjudump() ? snapshot_objdump : 0) | (f->isAsmSourceCode() ? snapshot_asm : 0) |
+                    (f->isIR() ? snapshot_ir : 0) | (f->isRepeat() ? snapshot_repeat : 0));
+            w.put32(f->InstNum);
+            w.put32(f->CallInstNum);
+            w.put32(f->JumpInstNum);
+            w.put32(f->NumberBasicBlock);
+            w.put32(f->NumberBasicBlockReal);
+
+            w.put32(f->InstASM.size());
+            for (uint32_t j = 0; j < f->InstASM.size(); j++) {
+                DAInstruction *inst = f->InstASM[j];
+                inst_id[inst] = std::make_pair(i, j);
+                w.putString(inst->Address);
+                w.put64(inst->address);
+                w.putString(inst->OInst);
+                w.putString(inst->SInst);
+                w.putString(inst->BasicBlockName);
+            }
+
+            w.put32(f->BasicBlock.size());
+            for (auto &it : f->BasicBlock) {
+                DBasicBlock *b = it.second;
+                w.putString(DSymbol::name(it.first));
+                w.put32((b->isIr() ? snapshot_ir : 0) | (b->isAsmSourceCode() ? snapshot_asm : 0) |
+                        (b->parent != nullptr ? snapshot_parent : 0));
+                w.put64(b->trace_pc_address);
+                w.put64(b->trace_cmp_address);
+                w.put64(b->tracr_num);
+                w.put32(b->InstASM.size());
+                for (auto *inst : b->InstASM) {
+                    auto id = inst_id.find(inst);
+                    if (id == inst_id.end() || id->second.first != i) {
+                        std::cerr << "snapshot: instruction of basic block " << b->name << " is not in function "
+                                  << f->FunctionName << std::endl;
+                        return false;
+                    }
+                    w.put32(id->second.second);
+                }
+            }
+        }
+
+        w.put32(M->Function.size());
+        for (auto &p : M->Function) {
+            w.putString(DSymbol::name(p.first));
+            w.put32(p.second.size());
+            for (auto &f : p.second) {
+                w.putString(DSymbol::name(f.first));
+                w.put32(function_id[f.second]);
+            }
+        }
+        for (auto *repeat : {&M->RepeatBCFunction, &M->RepeatOFunction}) {
+            w.put32(repeat->size());
+            for (auto &f : *repeat) {
+                w.putString(f.first);
+                w.put32(function_id[f.second]);
+            }
+        }
+        w.put32(M->RepeatSFunction.size());
+        for (auto &p : M->RepeatSFunction) {
+            w.putString(DSymbol::name(p.first));
+            w.put32(p.second.size());
+            for (auto &f : p.second) {
+                w.putString(DSymbol::name(f.first));
+                w.put32(function_id[f.second]);
+            }
+        }
+
+        const DAddressIndex &index = DM->AddressIndex;
+        w.put64(index.size());
+        for (uint64_t i = 0; i < index.size(); i++) {
+            auto id = inst_id.find(index.Inst[i]);
+            if (id == inst_id.end()) {
+                std::cerr << "snapshot: unknown instruction of address " << index.Address[i] << std::endl;
+                return false;
+            }
+            w.put64(index.Address[i]);
+            w.put32(id->second.first);
+            w.put32(id->second.second);
+        }
+
+        SnapshotWriter header;
+        header.put64(Magic);
+        header.put32(Version);
+        header.put32(0);
+        for (auto k : this->Key) {
+            header.put64(k);
+        }
+        header.put32(M->NumberBasicBlock);
+        header.put32(M->NumberBasicBlockReal);
+        header.put32(w.strings.size());
+        uint64_t size = header.body.size() + sizeof(uint64_t) + w.body.size();
+        for (auto s : w.strings) {
+            size += sizeof(uint32_t) + s.size();
+        }
+        header.put64(size);
+        for (auto s : w.strings) {
+            header.put32(s.size());
+            header.body.append(s.data(), s.size());
+        }
+
+        std::string temp = this->Path + ".tmp";
+        std::ofstream output(temp, std::ios::out | std::ios::trunc | std::ios::binary);
+        output.write(header.body.data(), header.body.size());
+        output.write(w.body.data(), w.body.size());
+        output.close();
+        if (!output || std::rename(temp.c_str(), this->Path.c_str()) != 0) {
+            std::cerr << "Failed to write snapshot " << this->Path << std::endl;
+            std::remove(temp.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool DSnapshot::read(DataManagement *DM) {
+        auto buffer = dra::mapFile(this->Path);
+        if (!buffer) {
+            return false;
+        }
+        DModule *M = DM->Modules;
+        SnapshotReader r((*buffer)->getBuffer());
+        if (r.get64() != Magic || r.get32() != Version) {
+            return false;
+        }
+        r.get32();
+        for (auto k : this->Key) {
+            if (r.get64() != k) {
+                return false;
+            }
+        }
+        uint32_t number_basic_block = r.get32();
+        uint32_t number_basic_block_real = r.get32();
+        // a lazily read bit code has no IR functions yet, they are all created from the snapshot
+        if (!M->Lazy &&
+            (number_basic_block != M->NumberBasicBlock || number_basic_block_real != M->NumberBasicBlockReal)) {
+            return false;
+        }
+        uint32_t number_string = r.get32();
+        // a snapshot cut by a crash is never used
+        if (r.get64() != (*buffer)->getBufferSize() || r.fail) {
+            return false;
+        }
+        r.strings.reserve(number_string);
+        for (uint32_t i = 0; i < number_string && !r.fail; i++) {
+            r.strings.push_back(r.getBytes(r.get32()));
+        }
+
+        uint32_t number_function = r.get32();
+        if (number_function < M->AllFunction.size()) {
+            return false;
+        }
+        if (!r.fits(number_function, 3 * sizeof(uint32_t))) {
+            return false;
+        }
+        std::vector<llvm::StringRef> identity(number_function * 3);
+        for (auto &s : identity) {
+            s = r.getString();
+        }
+        for (uint32_t i = 0; i < M->AllFunction.size(); i++) {
+            DFunction *f = M->AllFunction[i];
+            if (f->Path != identity[i * 3] || f->FunctionName != identity[i * 3 + 1] ||
+                f->IRName != identity[i * 3 + 2]) {
+                std::cerr << "snapshot does not match the bit code : " << f->FunctionName << std::endl;
+                return false;
+            }
+        }
+        if (r.fail) {
+            return false;
+        }
+
+        // decode and check everything before the module is changed
+        std::vector<SnapshotFunction> functions(number_function);
+        for (auto &f : functions) {
+            f.Address = r.getStringId();
+            f.flag = r.get32();
+            f.InstNum = r.get32();
+            f.CallInstNum = r.get32();
+            f.JumpInstNum = r.get32();
+            f.NumberBasicBlock = r.get32();
+            f.NumberBasicBlockReal = r.get32();
+
+            uint32_t number_inst = r.get32();
+            if (!r.fits(number_inst, 4 * sizeof(uint32_t) + sizeof(uint64_t))) {
+                break;
+            }
+            f.InstASM.resize(number_inst);
+            for (auto &inst : f.InstASM) {
+                inst.Address = r.getStringId();
+                inst.address = r.get64();
+                inst.OInst = r.getStringId();
+                inst.SInst = r.getStringId();
+                inst.BasicBlockName = r.getStringId();
+            }
+
+            uint32_t number_bb = r.get32();
+            if (!r.fits(number_bb, 3 * sizeof(uint32_t) + 3 * sizeof(uint64_t))) {
+                break;
+            }
+            f.BasicBlock.resize(number_bb);
+            for (auto &b : f.BasicBlock) {
+                b.name = r.getStringId();
+                b.flag = r.get32();
+                b.trace_pc_address = r.get64();
+                b.trace_cmp_address = r.get64();
+                b.tracr_num = r.get64();
+                uint32_t number_bb_inst = r.get32();
+                if (!r.fits(number_bb_inst, sizeof(uint32_t))) {
+                    break;
+                }
+                b.InstASM.resize(number_bb_inst);
+                for (auto &index : b.InstASM) {
+                    index = r.get32();
+                    if (index >= number_inst) {
+                        r.fail = true;
+                    }
+                }
+            }
+            if (r.fail) {
+                break;
+            }
+        }
+
+        auto getFunction = [&]() -> uint32_t {
+            uint32_t id = r.get32();
+            if (id >= number_function) {
+                r.fail = true;
+                return 0;
+            }
+            return id;
+        };
+        auto getTable = [&](SnapshotFunctionTable &table) {
+            uint32_t number_path = r.get32();
+            for (uint32_t i = 0; i < number_path && !r.fail; i++) {
+                auto &p = table[r.getStringId()];
+                uint32_t number = r.get32();
+                for (uint32_t j = 0; j < number && !r.fail; j++) {
+                    uint32_t name = r.getStringId();
+                    p[name] = getFunction();
+                }
+            }
+        };
+        SnapshotFunctionTable function_table;
+        getTable(function_table);
+        std::vector<std::pair<uint32_t, uint32_t>> repeat[2];
+        for (auto &table : repeat) {
+            uint32_t number = r.get32();
+            for (uint32_t j = 0; j < number && !r.fail; j++) {
+                uint32_t name = r.getStringId();
+                table.emplace_back(name, getFunction());
+            }
+        }
+        SnapshotFunctionTable repeat_s_table;
+        getTable(repeat_s_table);
+
+        uint64_t number_address = r.get64();
+        std::vector<SnapshotAddress> addresses;
+        if (r.fits(number_address, sizeof(uint64_t) + 2 * sizeof(uint32_t))) {
+            addresses.resize(number_address);
+        }
+        for (auto &a : addresses) {
+            a.address = r.get64();
+            a.function = getFunction();
+            a.index = r.get32();
+            if (r.fail || a.index >= functions[a.function].InstASM.size()) {
+                r.fail = true;
+                break;
+            }
+        }
+        if (r.fail) {
+            std::cerr << "broken snapshot " << this->Path << ", rebuild it" << std::endl;
+            return false;
+        }
+
+        // commit the decoded tables to the module
+        auto str = [&](uint32_t id) -> std::string {
+            return r.strings[id].str();
+        };
+        for (uint32_t i = 0; i < number_function; i++) {
+            const SnapshotFunction &sf = functions[i];
+            DFunction *f;
+            if (i < M->AllFunction.size()) {
+                f = M->AllFunction[i];
+            } else {
+                f = M->FunctionArena.create();
+                f->Path = identity[i * 3].str();
+                f->FunctionName = identity[i * 3 + 1].str();
+                f->IRName = identity[i * 3 + 2].str();
+                M->AllFunction.push_back(f);
+            }
+            f->Address = str(sf.Address);
+            f->setObjudump((sf.flag & snapshot_objdump) != 0);
+            f->setAsmSourceCode((sf.flag & snapshot_asm) != 0);
+            f->setIR((sf.flag & snapshot_ir) != 0);
+            f->setRepeat((sf.flag & snapshot_repeat) != 0);
+            if (M->Lazy && f->isIR() && f->function == nullptr) {
+                f->function = M->module->getFunction(f->IRName);
+                f->parent = M;
+            }
+            f->InstNum = sf.InstNum;
+            f->CallInstNum = sf.CallInstNum;
+            f->JumpInstNum = sf.JumpInstNum;
+            f->NumberBasicBlock = sf.NumberBasicBlock;
+            f->NumberBasicBlockReal = sf.NumberBasicBlockReal;
+
+            f->InstASM.reserve(sf.InstASM.size());
+            for (const auto &si : sf.InstASM) {
+                auto *inst = M->InstASMArena.create();
+                inst->Address = str(si.Address);
+                inst->address = si.address;
+                inst->OInst = str(si.OInst);
+                inst->SInst = str(si.SInst);
+                inst->BasicBlockName = str(si.BasicBlockName);
+                f->InstASM.push_back(inst);
+            }
+
+            for (const auto &sb : sf.BasicBlock) {
+                llvm::StringRef name = r.strings[sb.name];
+                auto &b = f->BasicBlock[DSymbol::intern(name)];
+                if (b == nullptr) {
+                    b = M->BasicBlockArena.create();
+                    b->name = name.str();
+                    b->setIr((sb.flag & snapshot_ir) != 0);
+                }
+                if (sb.flag & snapshot_parent) {
+                    b->parent = f;
+                }
+                b->setAsmSourceCode((sb.flag & snapshot_asm) != 0);
+                b->trace_pc_address = sb.trace_pc_address;
+                b->trace_cmp_address = sb.trace_cmp_address;
+                b->tracr_num = sb.tracr_num;
+                for (uint32_t index : sb.InstASM) {
+                    f->InstASM[index]->parent = b;
+                    b->InstASM.push_back(f->InstASM[index]);
+                }
+            }
+        }
+
+        auto setTable = [&](const SnapshotFunctionTable &from,
+                            std::unordered_map<uint32_t, std::unordered_map<uint32_t, DFunction *>> &to) {
+            to.clear();
+            for (const auto &p : from) {
+                auto &names = to[DSymbol::intern(r.strings[p.first])];
+                for (const auto &f : p.second) {
+                    names[DSymbol::intern(r.strings[f.first])] = M->AllFunction[f.second];
+                }
+            }
+        };
+        setTable(function_table, M->Function);
+        setTable(repeat_s_table, M->RepeatSFunction);
+        // the IR functions of a lazily read bit code are only known by their names up to here
+        for (DFunction *f : M->AllFunction) {
+            if (f->function != nullptr) {
+                M->FunctionOf[f->function] = M->get_DF_from_name(f->Path, f->FunctionName);
+            }
+        }
+        std::unordered_map<std::string, DFunction *> *repeat_table[2] = {&M->RepeatBCFunction, &M->RepeatOFunction};
+        for (int t = 0; t < 2; t++) {
+            repeat_table[t]->clear();
+            for (const auto &f : repeat[t]) {
+                (*repeat_table[t])[str(f.first)] = M->AllFunction[f.second];
+            }
+        }
+
+        std::vector<std::pair<uint64_t, DAInstruction *>> entries;
+        entries.reserve(addresses.size());
+        for (const auto &a : addresses) {
+            entries.emplace_back(a.address, M->AllFunction[a.function]->InstASM[a.index]);
+        }
+        DM->AddressIndex.build(entries);
+        if (M->Lazy) {
+            M->NumberBasicBlock = number_basic_block;
+            M->NumberBasicBlockReal = number_basic_block_real;
+        }
+#if DEBUG_SNAPSHOT
+        std::cout << "snapshot functions : " << number_function << std::endl;
+        std::cout << "snapshot addresses : " << number_address << std::endl;
+#endif
+        return true;
+    }
+
+} /* namespace dra */
@@ -0,0 +1,56 @@
+/*
+ * DSnapshot.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef LIB_DRA_DSNAPSHOT_H_
+#define LIB_DRA_DSNAPSHOT_H_
+
+#include <cstdint>
+#include <string>
+
+#define DEBUG_SNAPSHOT 0
+
+namespace dra {
+    class DataManagement;
+} /* namespace dra */
+
+namespace dra {
+
+    // Binary snapshot of the module model built by initializeModule from the objdump and the assembly:
+    // functions, basic blocks, trace_pc addresses, repeat tables and the address index.
+    // The bit code is still loaded, the snapshot is only used if the hashes of all inputs match.
+    //
+    // layout, little endian:
+    //   header: magic, version, hash of objdump, asm, bit code and addr2line .bin, counts
+    //   string table: length + bytes
+    //   functions in creation order, with their instructions and basic blocks
+    //   Function, RepeatBCFunction, RepeatOFunction, RepeatSFunction as function ids
+    //   the address index as (address, function id, instruction index), sorted by address
+    class DSnapshot {
+    public:
+        DSnapshot(const std::string &objdump, const std::string &AssemblySourceCode, const std::string &bit_code,
+                  uint32_t thread);
+
+        virtual ~DSnapshot();
+
+        // rebuild the model on top of the functions created by ReadBC.
+        // false if the snapshot can not be used, the model is only changed once the whole snapshot is valid.
+        bool read(DataManagement *DM);
+
+        bool write(DataManagement *DM);
+
+        static uint64_t hashFile(const std::string &path, uint32_t thread);
+
+    public:
+        static const uint64_t Magic;
+        static const uint32_t Version;
+
+        std::string Path;
+        uint64_t Key[4];
+    };
+
+} /* namespace dra */
+
+#endif /* LIB_DRA_DSNAPSHOT_H_ */
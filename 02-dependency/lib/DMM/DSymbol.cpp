@@ -0,0 +1,188 @@
+/*
+ * DSymbol.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "DSymbol.h"
+
+#include <llvm/ADT/Hashing.h>
+#include <llvm/Support/Allocator.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace dra {
+
+    const uint32_t DSymbol::None = UINT32_MAX;
+
+    namespace {
+        // a name belongs to one shard by its hash, so the parallel parsers rarely wait for the same lock
+        const uint32_t ShardBits = 6;
+        const uint32_t NumberShard = 1 << ShardBits;
+        const uint32_t InitialSlot = 1 << 10;
+        // the names by id, in chunks which never move, so name() needs no lock
+        const uint32_t ChunkBits = 16;
+        const uint32_t ChunkSize = 1 << ChunkBits;
+        const uint32_t NumberChunk = 1 << (32 - ChunkBits);
+
+        struct Entry {
+            size_t hash;
+            llvm::StringRef key;
+            uint32_t id;
+        };
+
+        // open addressing with linear probing. a slot is written once, after its entry is complete, so a reader
+        // which sees the pointer sees the entry.
+        struct Slots {
+            explicit Slots(size_t size) : mask(size - 1), slot(new std::atomic<const Entry *>[size]) {
+                for (size_t i = 0; i < size; i++) {
+                    slot[i].store(nullptr, std::memory_order_relaxed);
+                }
+            }
+
+            const Entry *find(size_t hash, llvm::StringRef name) const {
+                for (size_t i = (hash >> ShardBits) & mask;; i = (i + 1) & mask) {
+                    const Entry *e = slot[i].load(std::memory_order_acquire);
+                    if (e == nullptr || (e->hash == hash && e->key == name)) {
+                        return e;
+                    }
+                }
+            }
+
+            void insert(const Entry *e) {
+                size_t i = (e->hash >> ShardBits) & mask;
+                while (slot[i].load(std::memory_order_relaxed) != nullptr) {
+                    i = (i + 1) & mask;
+                }
+                slot[i].store(e, std::memory_order_release);
+            }
+
+            const size_t mask;
+            std::unique_ptr<std::atomic<const Entry *>[]> slot;
+        };
+
+        // lookup reads the current slots without the lock. only intern takes it, and a full table is replaced by
+        // a bigger one instead of being rehashed in place, the old one is kept for the readers still in it.
+        struct Shard {
+            std::mutex lock;
+            std::atomic<const Slots *> current{nullptr};
+            size_t number{0};
+            llvm::BumpPtrAllocator allocator;
+            std::vector<std::unique_ptr<Slots>> tables;
+
+            Shard() {
+                tables.emplace_back(new Slots(InitialSlot));
+                current.store(tables.back().get(), std::memory_order_release);
+            }
+
+            const Entry *find(size_t hash, llvm::StringRef name) const {
+                return current.load(std::memory_order_acquire)->find(hash, name);
+            }
+
+            // with the lock held
+            void insert(const Entry *e) {
+                Slots *slots = tables.back().get();
+                if ((number + 1) * 4 > (slots->mask + 1) * 3) {
+                    auto *bigger = new Slots((slots->mask + 1) * 2);
+                    for (size_t i = 0; i <= slots->mask; i++) {
+                        if (const Entry *old = slots->slot[i].load(std::memory_order_relaxed)) {
+                            bigger->insert(old);
+                        }
+                    }
+                    tables.emplace_back(bigger);
+                    slots = bigger;
+                    current.store(slots, std::memory_order_release);
+                }
+                slots->insert(e);
+                number++;
+            }
+        };
+
+        struct SymbolTable {
+            Shard shard[NumberShard];
+            std::atomic<uint32_t> next{0};
+            std::atomic<llvm::StringRef *> chunk[NumberChunk];
+
+            SymbolTable() {
+                for (auto &c : chunk) {
+                    c.store(nullptr, std::memory_order_relaxed);
+                }
+            }
+
+            Shard &shardOf(size_t hash) {
+                return shard[hash & (NumberShard - 1)];
+            }
+
+            llvm::StringRef *chunkOf(uint32_t id) {
+                auto &c = chunk[id >> ChunkBits];
+                llvm::StringRef *res = c.load(std::memory_order_acquire);
+                if (res == nullptr) {
+                    auto *fresh = new llvm::StringRef[ChunkSize];
+                    if (c.compare_exchange_strong(res, fresh, std::memory_order_acq_rel)) {
+                        res = fresh;
+                    } else {
+                        delete[] fresh;
+                    }
+                }
+                return res;
+            }
+        };
+
+        SymbolTable &table() {
+            static SymbolTable *t = new SymbolTable();
+            return *t;
+        }
+    } /* namespace */
+
+    uint32_t DSymbol::intern(llvm::StringRef name) {
+        SymbolTable &t = table();
+        size_t hash = llvm::hash_value(name);
+        Shard &s = t.shardOf(hash);
+        if (const Entry *e = s.find(hash, name)) {
+            return e->id;
+        }
+        std::lock_guard<std::mutex> guard(s.lock);
+        if (const Entry *e = s.find(hash, name)) {
+            return e->id;
+        }
+        char *key = s.allocator.Allocate<char>(name.size() + 1);
+        std::copy(name.begin(), name.end(), key);
+        key[name.size()] = '\0';
+        auto *e = new(s.allocator.Allocate<Entry>()) Entry{hash, llvm::StringRef(key, name.size()),
+                                                           t.next.fetch_add(1, std::memory_order_relaxed)};
+        // the name slot is written before the entry is published, so whoever gets the id from this call or from
+        // lookup sees it
+        t.chunkOf(e->id)[e->id & (ChunkSize - 1)] = e->key;
+        s.insert(e);
+        return e->id;
+    }
+
+    uint32_t DSymbol::lookup(llvm::StringRef name) {
+        size_t hash = llvm::hash_value(name);
+        const Entry *e = table().shardOf(hash).find(hash, name);
+        if (e == nullptr) {
+            return None;
+        }
+        return e->id;
+    }
+
+    llvm::StringRef DSymbol::name(uint32_t id) {
+        SymbolTable &t = table();
+        if (id >= t.next.load(std::memory_order_acquire)) {
+            return "";
+        }
+        llvm::StringRef *c = t.chunk[id >> ChunkBits].load(std::memory_order_acquire);
+        if (c == nullptr) {
+            return "";
+        }
+        return c[id & (ChunkSize - 1)];
+    }
+
+    uint64_t DSymbol::size() {
+        return table().next.load(std::memory_order_acquire);
+    }
+
+} /* namespace dra */
@@ -0,0 +1,37 @@
+/*
+ * DSymbol.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef LIB_DRA_DSYMBOL_H_
+#define LIB_DRA_DSYMBOL_H_
+
+#include <llvm/ADT/StringRef.h>
+#include <cstdint>
+
+namespace dra {
+
+    // global symbol table for the names which key the model: paths, function names, IR names,
+    // function addresses and basic block names.
+    // a name is interned once when it is loaded and the maps of DModule and DFunction are keyed by its id.
+    // the table only grows and is safe to use from the parallel parsers: intern of a new name locks one of several
+    // shards, lookup, name and size take no lock. an id is only valid once the intern which made it has returned.
+    class DSymbol {
+    public:
+        static const uint32_t None;
+
+        // the id of name, a new id if name is not in the table yet
+        static uint32_t intern(llvm::StringRef name);
+
+        // the id of name or None, the table is not changed. a name which was never interned is not a key of any map.
+        static uint32_t lookup(llvm::StringRef name);
+
+        static llvm::StringRef name(uint32_t id);
+
+        static uint64_t size();
+    };
+
+} /* namespace dra */
+
+#endif /* LIB_DRA_DSYMBOL_H_ */
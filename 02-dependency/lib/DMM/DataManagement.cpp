@@ -6,6 +6,7 @@
  */
 
 #include "DataManagement.h"
+#include "DSnapshot.h"
 #include "llvm/IR/CFG.h"
 #include "../DCC/general.h"
 #include <llvm/IR/DebugLoc.h>
@@ -20,8 +21,8 @@ namespace dra {
 
     DataManagement::DataManagement() {
         vmOffsets = 0;
+        useSnapshot = true;
         Modules = new dra::DModule();
-        Address2BB.reserve(1000000);
     }
 
     DataManagement::~DataManagement() = default;
@@ -35,24 +36,52 @@ namespace dra {
         std::cout << "o Cmd :" << Cmd << std::endl;
 #endif
         Modules->ReadBC(bit_code);
+        if (!this->useSnapshot) {
+            Modules->materializeAll();
+            Modules->ReadObjdump(objdump);
+            Modules->ReadAsmSourceCode(AssemblySourceCode);
+            BuildAddressIndex();
+            return;
+        }
+
+        DSnapshot snapshot(objdump, AssemblySourceCode, bit_code, Modules->NumberThread);
+        if (snapshot.read(this)) {
+            dra::outputTime("read snapshot " + snapshot.Path);
+            return;
+        }
+        Modules->materializeAll();
         Modules->ReadObjdump(objdump);
         Modules->ReadAsmSourceCode(AssemblySourceCode);
-        BuildAddress2BB();
+        BuildAddressIndex();
+        if (snapshot.write(this)) {
+            dra::outputTime("write snapshot " + snapshot.Path);
+        }
 
     }
 
-    void DataManagement::BuildAddress2BB() {
+    void DataManagement::BuildAddressIndex() {
+        uint64_t number_address = 0;
+        for (const auto &file : Modules->Function) {
+            for (const auto &function : file.second) {
+                if (!function.second->isRepeat()) {
+                    number_address += function.second->InstASM.size();
+                }
+            }
+        }
+        std::vector<std::pair<uint64_t, DAInstruction *>> entries;
+        entries.reserve(number_address);
         for (const auto &file : Modules->Function) {
             for (const auto &function : file.second) {
                 if (function.second->isRepeat()) {
 
                 } else {
                     for (auto inst : function.second->InstASM) {
-                        Address2BB[inst->address] = inst;
+                        entries.emplace_back(inst->address, inst);
                     }
                 }
             }
         }
+        AddressIndex.build(entries);
     }
 
     void DataManagement::getInput(const std::string &coverfile) {
@@ -115,14 +144,18 @@ namespace dra {
     }
 
     void DataManagement::setInput() {
+        std::vector<uint64_t> address;
+        std::vector<DAInstruction *> inst;
         for (const auto &it : this->Inputs) {
             std::string sig = it.first;
-            for (auto addr : it.second->MaxCover) {
-                if (this->Address2BB.find(addr) != this->Address2BB.end()) {
-                    this->Address2BB[addr]->update(CoverKind::cover, it.second);
+            address.assign(it.second->MaxCover.begin(), it.second->MaxCover.end());
+            this->AddressIndex.find(address, inst);
+            for (uint64_t i = 0; i < address.size(); i++) {
+                if (inst[i] != nullptr) {
+                    inst[i]->update(CoverKind::cover, it.second);
                 } else {
 #if DEBUG_ERR
-                    std::cerr << "un find trace_pc_address " << std::hex << addr << "\n";
+                    std::cerr << "un find trace_pc_address " << std::hex << address[i] << "\n";
 #endif
                 }
 
@@ -150,14 +183,19 @@ namespace dra {
             dInput->setProgram(program);
         }
         dInput->Number++;
+        std::vector<uint64_t> call_address;
+        std::vector<DAInstruction *> call_inst;
         for (const auto &c : input->call()) {
             dInput->idx = c.second.idx();
+            call_address.clear();
             for (const auto &a : c.second.address()) {
-                unsigned long long int address = a.first;
-//                unsigned long long int address = a;
-                auto final_address = getRealAddress(address);
-                if (this->Address2BB.find(final_address) != this->Address2BB.end()) {
-                    this->Address2BB[final_address]->update(CoverKind::cover, dInput);
+                call_address.push_back(getRealAddress(a.first));
+            }
+            this->AddressIndex.find(call_address, call_inst);
+            for (uint64_t i = 0; i < call_address.size(); i++) {
+                auto final_address = call_address[i];
+                if (call_inst[i] != nullptr) {
+                    call_inst[i]->update(CoverKind::cover, dInput);
 //                    this->dump_address(final_address);
                 } else {
 #if DEBUG_ERR
@@ -220,9 +258,10 @@ namespace dra {
 
         return true;
 
-        if (this->Address2BB.find(address) != this->Address2BB.end()) {
-            if (this->Address2BB[address]->parent != nullptr) {
-                auto b = this->Address2BB[address]->parent;
+        auto inst = this->AddressIndex.find(address);
+        if (inst != nullptr) {
+            if (inst->parent != nullptr) {
+                auto b = inst->parent;
                 if (b->parent != nullptr) {
                     auto f = b->parent;
                     if (f->Path.find("block/") == 0) {
@@ -254,9 +293,10 @@ namespace dra {
 
     void DataManagement::dump_address(unsigned long long int address) {
 
-        if (this->Address2BB.find(address) != this->Address2BB.end()) {
-            if (this->Address2BB[address]->parent != nullptr) {
-                auto b = this->Address2BB[address]->parent;
+        auto inst = this->AddressIndex.find(address);
+        if (inst != nullptr) {
+            if (inst->parent != nullptr) {
+                auto b = inst->parent;
                 if (b->parent != nullptr) {
                     auto f = b->parent;
                     std::cout << "dump_address path : " << f->Path << "\n";
@@ -336,9 +376,25 @@ namespace dra {
         return this->Modules->get_DB_from_i(i);
     }
 
+    DAInstruction *DataManagement::get_DI_from_address(uint64_t address) const {
+        return this->AddressIndex.find(address);
+    }
+
+    DBasicBlock *DataManagement::get_DB_from_address(uint64_t address) {
+        DAInstruction *inst = this->AddressIndex.find(address);
+        if (inst == nullptr) {
+            return nullptr;
+        }
+        DBasicBlock *db = inst->parent;
+        if (db != nullptr && db->parent != nullptr) {
+            db->parent->materialize();
+        }
+        return db;
+    }
+
     bool DataManagement::check_uncovered_address(Condition *u) {
         bool res = false;
-        if (this->Address2BB.find(u->condition_address()) != this->Address2BB.end()) {
+        if (this->AddressIndex.find(u->condition_address()) != nullptr) {
             res = true;
         } else {
             std::cerr << "can not find condition_address : " << std::hex << u->condition_address() << std::endl;
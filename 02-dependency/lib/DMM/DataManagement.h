@@ -13,6 +13,7 @@
 #include <string>
 #include <unordered_map>
 
+#include "DAddressIndex.h"
 #include "DAInstruction.h"
 #include "DFunction.h"
 #include "DInput.h"
@@ -50,7 +51,7 @@ namespace dra {
 
         void initializeModule(const std::string& objdump, const std::string& AssemblySourceCode, const std::string& bit_code);
 
-        void BuildAddress2BB();
+        void BuildAddressIndex();
 
         void getVmOffsets(std::string vm_offsets);
 
@@ -82,18 +83,27 @@ namespace dra {
 
         DBasicBlock *get_DB_from_i(llvm::Instruction *i);
 
+        // the instruction of an address, nullptr if it is not a trace_pc address
+        DAInstruction *get_DI_from_address(uint64_t address) const;
+
+        // the basic block of an address, with the body of its function loaded
+        DBasicBlock *get_DB_from_address(uint64_t address);
+
         void set_condition(Condition *) const;
 
 
     public:
         dra::DModule *Modules;
-        std::unordered_map<uint64_t, DAInstruction *> Address2BB;
+        // from the address of an instruction to the instruction
+        DAddressIndex AddressIndex;
         std::unordered_map<std::string, DInput *> Inputs;
 //        dra::all_data Add_Data;
         std::map<uint64_t, std::time_t> cover;
         std::map<uint64_t, uncover_info *> uncover;
         // std::vector<coverage *> time;
         unsigned long long int vmOffsets;
+        // load the module model from <vmlinux>.snapshot if the inputs did not change, and write it otherwise
+        bool useSnapshot;
 
     };
 
@@ -41,6 +41,9 @@ static const char* DependencyRPC_method_names[] = {
   "/dra.DependencyRPC/sendStat",
   "/dra.DependencyRPC/GetNeed",
   "/dra.DependencyRPC/SendNeedInput",
+  "/dra.DependencyRPC/StreamNewInput",
+  "/dra.DependencyRPC/StreamCondition",
+  "/dra.DependencyRPC/SendDependencies",
 };
 
 std::unique_ptr< DependencyRPC::Stub> DependencyRPC::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -69,6 +72,9 @@ DependencyRPC::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& chan
   , rpcmethod_sendStat_(DependencyRPC_method_names[16], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_GetNeed_(DependencyRPC_method_names[17], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_SendNeedInput_(DependencyRPC_method_names[18], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_StreamNewInput_(DependencyRPC_method_names[19], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_StreamCondition_(DependencyRPC_method_names[20], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_SendDependencies_(DependencyRPC_method_names[21], options.suffix_for_stats(),::grpc::internal::RpcMethod::CLIENT_STREAMING, channel)
   {}
 
 ::grpc::Status DependencyRPC::Stub::GetVMOffsets(::grpc::ClientContext* context, const ::dra::Empty& request, ::dra::Empty* response) {
@@ -508,6 +514,54 @@ void DependencyRPC::Stub::async::SendNeedInput(::grpc::ClientContext* context, c
   return result;
 }
 
+::grpc::ClientReader< ::dra::Inputs>* DependencyRPC::Stub::StreamNewInputRaw(::grpc::ClientContext* context, const ::dra::Empty& request) {
+  return ::grpc::internal::ClientReaderFactory< ::dra::Inputs>::Create(channel_.get(), rpcmethod_StreamNewInput_, context, request);
+}
+
+void DependencyRPC::Stub::async::StreamNewInput(::grpc::ClientContext* context, const ::dra::Empty* request, ::grpc::ClientReadReactor< ::dra::Inputs>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::dra::Inputs>::Create(stub_->channel_.get(), stub_->rpcmethod_StreamNewInput_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::dra::Inputs>* DependencyRPC::Stub::AsyncStreamNewInputRaw(::grpc::ClientContext* context, const ::dra::Empty& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::dra::Inputs>::Create(channel_.get(), cq, rpcmethod_StreamNewInput_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::dra::Inputs>* DependencyRPC::Stub::PrepareAsyncStreamNewInputRaw(::grpc::ClientContext* context, const ::dra::Empty& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::dra::Inputs>::Create(channel_.get(), cq, rpcmethod_StreamNewInput_, context, request, false, nullptr);
+}
+
+::grpc::ClientReader< ::dra::Conditions>* DependencyRPC::Stub::StreamConditionRaw(::grpc::ClientContext* context, const ::dra::Empty& request) {
+  return ::grpc::internal::ClientReaderFactory< ::dra::Conditions>::Create(channel_.get(), rpcmethod_StreamCondition_, context, request);
+}
+
+void DependencyRPC::Stub::async::StreamCondition(::grpc::ClientContext* context, const ::dra::Empty* request, ::grpc::ClientReadReactor< ::dra::Conditions>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::dra::Conditions>::Create(stub_->channel_.get(), stub_->rpcmethod_StreamCondition_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::dra::Conditions>* DependencyRPC::Stub::AsyncStreamConditionRaw(::grpc::ClientContext* context, const ::dra::Empty& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::dra::Conditions>::Create(channel_.get(), cq, rpcmethod_StreamCondition_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::dra::Conditions>* DependencyRPC::Stub::PrepareAsyncStreamConditionRaw(::grpc::ClientContext* context, const ::dra::Empty& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::dra::Conditions>::Create(channel_.get(), cq, rpcmethod_StreamCondition_, context, request, false, nullptr);
+}
+
+::grpc::ClientWriter< ::dra::Dependency>* DependencyRPC::Stub::SendDependenciesRaw(::grpc::ClientContext* context, ::dra::Empty* response) {
+  return ::grpc::internal::ClientWriterFactory< ::dra::Dependency>::Create(channel_.get(), rpcmethod_SendDependencies_, context, response);
+}
+
+void DependencyRPC::Stub::async::SendDependencies(::grpc::ClientContext* context, ::dra::Empty* response, ::grpc::ClientWriteReactor< ::dra::Dependency>* reactor) {
+  ::grpc::internal::ClientCallbackWriterFactory< ::dra::Dependency>::Create(stub_->channel_.get(), stub_->rpcmethod_SendDependencies_, context, response, reactor);
+}
+
+::grpc::ClientAsyncWriter< ::dra::Dependency>* DependencyRPC::Stub::AsyncSendDependenciesRaw(::grpc::ClientContext* context, ::dra::Empty* response, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncWriterFactory< ::dra::Dependency>::Create(channel_.get(), cq, rpcmethod_SendDependencies_, context, response, true, tag);
+}
+
+::grpc::ClientAsyncWriter< ::dra::Dependency>* DependencyRPC::Stub::PrepareAsyncSendDependenciesRaw(::grpc::ClientContext* context, ::dra::Empty* response, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncWriterFactory< ::dra::Dependency>::Create(channel_.get(), cq, rpcmethod_SendDependencies_, context, response, false, nullptr);
+}
+
 DependencyRPC::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       DependencyRPC_method_names[0],
@@ -699,6 +753,36 @@ DependencyRPC::Service::Service() {
              ::dra::Empty* resp) {
                return service->SendNeedInput(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      DependencyRPC_method_names[19],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< DependencyRPC::Service, ::dra::Empty, ::dra::Inputs>(
+          [](DependencyRPC::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::dra::Empty* req,
+             ::grpc::ServerWriter<::dra::Inputs>* writer) {
+               return service->StreamNewInput(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      DependencyRPC_method_names[20],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< DependencyRPC::Service, ::dra::Empty, ::dra::Conditions>(
+          [](DependencyRPC::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::dra::Empty* req,
+             ::grpc::ServerWriter<::dra::Conditions>* writer) {
+               return service->StreamCondition(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      DependencyRPC_method_names[21],
+      ::grpc::internal::RpcMethod::CLIENT_STREAMING,
+      new ::grpc::internal::ClientStreamingHandler< DependencyRPC::Service, ::dra::Dependency, ::dra::Empty>(
+          [](DependencyRPC::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReader<::dra::Dependency>* reader,
+             ::dra::Empty* resp) {
+               return service->SendDependencies(ctx, reader, resp);
+             }, this)));
 }
 
 DependencyRPC::Service::~Service() {
@@ -837,6 +921,27 @@ DependencyRPC::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status DependencyRPC::Service::StreamNewInput(::grpc::ServerContext* context, const ::dra::Empty* request, ::grpc::ServerWriter< ::dra::Inputs>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status DependencyRPC::Service::StreamCondition(::grpc::ServerContext* context, const ::dra::Empty* request, ::grpc::ServerWriter< ::dra::Conditions>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status DependencyRPC::Service::SendDependencies(::grpc::ServerContext* context, ::grpc::ServerReader< ::dra::Dependency>* reader, ::dra::Empty* response) {
+  (void) context;
+  (void) reader;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace dra
 
@@ -171,6 +171,36 @@ class DependencyRPC final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::dra::Empty>> PrepareAsyncSendNeedInput(::grpc::ClientContext* context, const ::dra::Input& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::dra::Empty>>(PrepareAsyncSendNeedInputRaw(context, request, cq));
     }
+    // DRA and syz-manager, pushed as they appear instead of polled by GetNewInput and GetCondition
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::dra::Inputs>> StreamNewInput(::grpc::ClientContext* context, const ::dra::Empty& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::dra::Inputs>>(StreamNewInputRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::dra::Inputs>> AsyncStreamNewInput(::grpc::ClientContext* context, const ::dra::Empty& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::dra::Inputs>>(AsyncStreamNewInputRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::dra::Inputs>> PrepareAsyncStreamNewInput(::grpc::ClientContext* context, const ::dra::Empty& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::dra::Inputs>>(PrepareAsyncStreamNewInputRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::dra::Conditions>> StreamCondition(::grpc::ClientContext* context, const ::dra::Empty& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::dra::Conditions>>(StreamConditionRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::dra::Conditions>> AsyncStreamCondition(::grpc::ClientContext* context, const ::dra::Empty& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::dra::Conditions>>(AsyncStreamConditionRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::dra::Conditions>> PrepareAsyncStreamCondition(::grpc::ClientContext* context, const ::dra::Empty& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::dra::Conditions>>(PrepareAsyncStreamConditionRaw(context, request, cq));
+    }
+    // DRA and syz-manager, the dependencies of SendDependency in one stream, a big one split into chunks
+    // by its write addresses, the chunks after the first have no input
+    std::unique_ptr< ::grpc::ClientWriterInterface< ::dra::Dependency>> SendDependencies(::grpc::ClientContext* context, ::dra::Empty* response) {
+      return std::unique_ptr< ::grpc::ClientWriterInterface< ::dra::Dependency>>(SendDependenciesRaw(context, response));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::dra::Dependency>> AsyncSendDependencies(::grpc::ClientContext* context, ::dra::Empty* response, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::dra::Dependency>>(AsyncSendDependenciesRaw(context, response, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::dra::Dependency>> PrepareAsyncSendDependencies(::grpc::ClientContext* context, ::dra::Empty* response, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriterInterface< ::dra::Dependency>>(PrepareAsyncSendDependenciesRaw(context, response, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
@@ -214,6 +244,12 @@ class DependencyRPC final {
       virtual void GetNeed(::grpc::ClientContext* context, const ::dra::Empty* request, ::dra::Empty* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void SendNeedInput(::grpc::ClientContext* context, const ::dra::Input* request, ::dra::Empty* response, std::function<void(::grpc::Status)>) = 0;
       virtual void SendNeedInput(::grpc::ClientContext* context, const ::dra::Input* request, ::dra::Empty* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // DRA and syz-manager, pushed as they appear instead of polled by GetNewInput and GetCondition
+      virtual void StreamNewInput(::grpc::ClientContext* context, const ::dra::Empty* request, ::grpc::ClientReadReactor< ::dra::Inputs>* reactor) = 0;
+      virtual void StreamCondition(::grpc::ClientContext* context, const ::dra::Empty* request, ::grpc::ClientReadReactor< ::dra::Conditions>* reactor) = 0;
+      // DRA and syz-manager, the dependencies of SendDependency in one stream, a big one split into chunks
+      // by its write addresses, the chunks after the first have no input
+      virtual void SendDependencies(::grpc::ClientContext* context, ::dra::Empty* response, ::grpc::ClientWriteReactor< ::dra::Dependency>* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -257,6 +293,15 @@ class DependencyRPC final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::dra::Empty>* PrepareAsyncGetNeedRaw(::grpc::ClientContext* context, const ::dra::Empty& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::dra::Empty>* AsyncSendNeedInputRaw(::grpc::ClientContext* context, const ::dra::Input& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::dra::Empty>* PrepareAsyncSendNeedInputRaw(::grpc::ClientContext* context, const ::dra::Input& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::dra::Inputs>* StreamNewInputRaw(::grpc::ClientContext* context, const ::dra::Empty& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::dra::Inputs>* AsyncStreamNewInputRaw(::grpc::ClientContext* context, const ::dra::Empty& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::dra::Inputs>* PrepareAsyncStreamNewInputRaw(::grpc::ClientContext* context, const ::dra::Empty& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::dra::Conditions>* StreamConditionRaw(::grpc::ClientContext* context, const ::dra::Empty& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::dra::Conditions>* AsyncStreamConditionRaw(::grpc::ClientContext* context, const ::dra::Empty& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::dra::Conditions>* PrepareAsyncStreamConditionRaw(::grpc::ClientContext* context, const ::dra::Empty& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientWriterInterface< ::dra::Dependency>* SendDependenciesRaw(::grpc::ClientContext* context, ::dra::Empty* response) = 0;
+    virtual ::grpc::ClientAsyncWriterInterface< ::dra::Dependency>* AsyncSendDependenciesRaw(::grpc::ClientContext* context, ::dra::Empty* response, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncWriterInterface< ::dra::Dependency>* PrepareAsyncSendDependenciesRaw(::grpc::ClientContext* context, ::dra::Empty* response, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -394,6 +439,33 @@ class DependencyRPC final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::dra::Empty>> PrepareAsyncSendNeedInput(::grpc::ClientContext* context, const ::dra::Input& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::dra::Empty>>(PrepareAsyncSendNeedInputRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReader< ::dra::Inputs>> StreamNewInput(::grpc::ClientContext* context, const ::dra::Empty& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::dra::Inputs>>(StreamNewInputRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::dra::Inputs>> AsyncStreamNewInput(::grpc::ClientContext* context, const ::dra::Empty& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::dra::Inputs>>(AsyncStreamNewInputRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::dra::Inputs>> PrepareAsyncStreamNewInput(::grpc::ClientContext* context, const ::dra::Empty& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::dra::Inputs>>(PrepareAsyncStreamNewInputRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< ::dra::Conditions>> StreamCondition(::grpc::ClientContext* context, const ::dra::Empty& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::dra::Conditions>>(StreamConditionRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::dra::Conditions>> AsyncStreamCondition(::grpc::ClientContext* context, const ::dra::Empty& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::dra::Conditions>>(AsyncStreamConditionRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::dra::Conditions>> PrepareAsyncStreamCondition(::grpc::ClientContext* context, const ::dra::Empty& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::dra::Conditions>>(PrepareAsyncStreamConditionRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientWriter< ::dra::Dependency>> SendDependencies(::grpc::ClientContext* context, ::dra::Empty* response) {
+      return std::unique_ptr< ::grpc::ClientWriter< ::dra::Dependency>>(SendDependenciesRaw(context, response));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriter< ::dra::Dependency>> AsyncSendDependencies(::grpc::ClientContext* context, ::dra::Empty* response, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriter< ::dra::Dependency>>(AsyncSendDependenciesRaw(context, response, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncWriter< ::dra::Dependency>> PrepareAsyncSendDependencies(::grpc::ClientContext* context, ::dra::Empty* response, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncWriter< ::dra::Dependency>>(PrepareAsyncSendDependenciesRaw(context, response, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
@@ -435,6 +507,9 @@ class DependencyRPC final {
       void GetNeed(::grpc::ClientContext* context, const ::dra::Empty* request, ::dra::Empty* response, ::grpc::ClientUnaryReactor* reactor) override;
       void SendNeedInput(::grpc::ClientContext* context, const ::dra::Input* request, ::dra::Empty* response, std::function<void(::grpc::Status)>) override;
       void SendNeedInput(::grpc::ClientContext* context, const ::dra::Input* request, ::dra::Empty* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void StreamNewInput(::grpc::ClientContext* context, const ::dra::Empty* request, ::grpc::ClientReadReactor< ::dra::Inputs>* reactor) override;
+      void StreamCondition(::grpc::ClientContext* context, const ::dra::Empty* request, ::grpc::ClientReadReactor< ::dra::Conditions>* reactor) override;
+      void SendDependencies(::grpc::ClientContext* context, ::dra::Empty* response, ::grpc::ClientWriteReactor< ::dra::Dependency>* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -484,6 +559,15 @@ class DependencyRPC final {
     ::grpc::ClientAsyncResponseReader< ::dra::Empty>* PrepareAsyncGetNeedRaw(::grpc::ClientContext* context, const ::dra::Empty& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::dra::Empty>* AsyncSendNeedInputRaw(::grpc::ClientContext* context, const ::dra::Input& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::dra::Empty>* PrepareAsyncSendNeedInputRaw(::grpc::ClientContext* context, const ::dra::Input& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::dra::Inputs>* StreamNewInputRaw(::grpc::ClientContext* context, const ::dra::Empty& request) override;
+    ::grpc::ClientAsyncReader< ::dra::Inputs>* AsyncStreamNewInputRaw(::grpc::ClientContext* context, const ::dra::Empty& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::dra::Inputs>* PrepareAsyncStreamNewInputRaw(::grpc::ClientContext* context, const ::dra::Empty& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::dra::Conditions>* StreamConditionRaw(::grpc::ClientContext* context, const ::dra::Empty& request) override;
+    ::grpc::ClientAsyncReader< ::dra::Conditions>* AsyncStreamConditionRaw(::grpc::ClientContext* context, const ::dra::Empty& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::dra::Conditions>* PrepareAsyncStreamConditionRaw(::grpc::ClientContext* context, const ::dra::Empty& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientWriter< ::dra::Dependency>* SendDependenciesRaw(::grpc::ClientContext* context, ::dra::Empty* response) override;
+    ::grpc::ClientAsyncWriter< ::dra::Dependency>* AsyncSendDependenciesRaw(::grpc::ClientContext* context, ::dra::Empty* response, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncWriter< ::dra::Dependency>* PrepareAsyncSendDependenciesRaw(::grpc::ClientContext* context, ::dra::Empty* response, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_GetVMOffsets_;
     const ::grpc::internal::RpcMethod rpcmethod_SendNumberBasicBlock_;
     const ::grpc::internal::RpcMethod rpcmethod_SendNumberBasicBlockCovered_;
@@ -503,6 +587,9 @@ class DependencyRPC final {
     const ::grpc::internal::RpcMethod rpcmethod_sendStat_;
     const ::grpc::internal::RpcMethod rpcmethod_GetNeed_;
     const ::grpc::internal::RpcMethod rpcmethod_SendNeedInput_;
+    const ::grpc::internal::RpcMethod rpcmethod_StreamNewInput_;
+    const ::grpc::internal::RpcMethod rpcmethod_StreamCondition_;
+    const ::grpc::internal::RpcMethod rpcmethod_SendDependencies_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -531,6 +618,12 @@ class DependencyRPC final {
     virtual ::grpc::Status sendStat(::grpc::ServerContext* context, const ::dra::Statistic* request, ::dra::Empty* response);
     virtual ::grpc::Status GetNeed(::grpc::ServerContext* context, const ::dra::Empty* request, ::dra::Empty* response);
     virtual ::grpc::Status SendNeedInput(::grpc::ServerContext* context, const ::dra::Input* request, ::dra::Empty* response);
+    // DRA and syz-manager, pushed as they appear instead of polled by GetNewInput and GetCondition
+    virtual ::grpc::Status StreamNewInput(::grpc::ServerContext* context, const ::dra::Empty* request, ::grpc::ServerWriter< ::dra::Inputs>* writer);
+    virtual ::grpc::Status StreamCondition(::grpc::ServerContext* context, const ::dra::Empty* request, ::grpc::ServerWriter< ::dra::Conditions>* writer);
+    // DRA and syz-manager, the dependencies of SendDependency in one stream, a big one split into chunks
+    // by its write addresses, the chunks after the first have no input
+    virtual ::grpc::Status SendDependencies(::grpc::ServerContext* context, ::grpc::ServerReader< ::dra::Dependency>* reader, ::dra::Empty* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_GetVMOffsets : public BaseClass {
@@ -912,7 +1005,67 @@ class DependencyRPC final {
       ::grpc::Service::RequestAsyncUnary(18, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_GetVMOffsets<WithAsyncMethod_SendNumberBasicBlock<WithAsyncMethod_SendNumberBasicBlockCovered<WithAsyncMethod_GetNewInput<WithAsyncMethod_SendDependency<WithAsyncMethod_GetCondition<WithAsyncMethod_SendWriteAddress<WithAsyncMethod_Connect<WithAsyncMethod_GetDataDependency<WithAsyncMethod_SendNewInput<WithAsyncMethod_GetTasks<WithAsyncMethod_GetBootTasks<WithAsyncMethod_ReturnTasks<WithAsyncMethod_SendBootInput<WithAsyncMethod_SendUnstableInput<WithAsyncMethod_SendLog<WithAsyncMethod_sendStat<WithAsyncMethod_GetNeed<WithAsyncMethod_SendNeedInput<Service > > > > > > > > > > > > > > > > > > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_StreamNewInput : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_StreamNewInput() {
+      ::grpc::Service::MarkMethodAsync(19);
+    }
+    ~WithAsyncMethod_StreamNewInput() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamNewInput(::grpc::ServerContext* /*context*/, const ::dra::Empty* /*request*/, ::grpc::ServerWriter< ::dra::Inputs>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStreamNewInput(::grpc::ServerContext* context, ::dra::Empty* request, ::grpc::ServerAsyncWriter< ::dra::Inputs>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(19, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_StreamCondition : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_StreamCondition() {
+      ::grpc::Service::MarkMethodAsync(20);
+    }
+    ~WithAsyncMethod_StreamCondition() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamCondition(::grpc::ServerContext* /*context*/, const ::dra::Empty* /*request*/, ::grpc::ServerWriter< ::dra::Conditions>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStreamCondition(::grpc::ServerContext* context, ::dra::Empty* request, ::grpc::ServerAsyncWriter< ::dra::Conditions>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(20, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_SendDependencies : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_SendDependencies() {
+      ::grpc::Service::MarkMethodAsync(21);
+    }
+    ~WithAsyncMethod_SendDependencies() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SendDependencies(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::dra::Dependency>* /*reader*/, ::dra::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSendDependencies(::grpc::ServerContext* context, ::grpc::ServerAsyncReader< ::dra::Empty, ::dra::Dependency>* reader, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncClientStreaming(21, context, reader, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_GetVMOffsets<WithAsyncMethod_SendNumberBasicBlock<WithAsyncMethod_SendNumberBasicBlockCovered<WithAsyncMethod_GetNewInput<WithAsyncMethod_SendDependency<WithAsyncMethod_GetCondition<WithAsyncMethod_SendWriteAddress<WithAsyncMethod_Connect<WithAsyncMethod_GetDataDependency<WithAsyncMethod_SendNewInput<WithAsyncMethod_GetTasks<WithAsyncMethod_GetBootTasks<WithAsyncMethod_ReturnTasks<WithAsyncMethod_SendBootInput<WithAsyncMethod_SendUnstableInput<WithAsyncMethod_SendLog<WithAsyncMethod_sendStat<WithAsyncMethod_GetNeed<WithAsyncMethod_SendNeedInput<WithAsyncMethod_StreamNewInput<WithAsyncMethod_StreamCondition<WithAsyncMethod_SendDependencies<Service > > > > > > > > > > > > > > > > > > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_GetVMOffsets : public BaseClass {
    private:
@@ -1426,7 +1579,73 @@ class DependencyRPC final {
     virtual ::grpc::ServerUnaryReactor* SendNeedInput(
       ::grpc::CallbackServerContext* /*context*/, const ::dra::Input* /*request*/, ::dra::Empty* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_GetVMOffsets<WithCallbackMethod_SendNumberBasicBlock<WithCallbackMethod_SendNumberBasicBlockCovered<WithCallbackMethod_GetNewInput<WithCallbackMethod_SendDependency<WithCallbackMethod_GetCondition<WithCallbackMethod_SendWriteAddress<WithCallbackMethod_Connect<WithCallbackMethod_GetDataDependency<WithCallbackMethod_SendNewInput<WithCallbackMethod_GetTasks<WithCallbackMethod_GetBootTasks<WithCallbackMethod_ReturnTasks<WithCallbackMethod_SendBootInput<WithCallbackMethod_SendUnstableInput<WithCallbackMethod_SendLog<WithCallbackMethod_sendStat<WithCallbackMethod_GetNeed<WithCallbackMethod_SendNeedInput<Service > > > > > > > > > > > > > > > > > > > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_StreamNewInput : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_StreamNewInput() {
+      ::grpc::Service::MarkMethodCallback(19,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::dra::Empty, ::dra::Inputs>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::dra::Empty* request) { return this->StreamNewInput(context, request); }));
+    }
+    ~WithCallbackMethod_StreamNewInput() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamNewInput(::grpc::ServerContext* /*context*/, const ::dra::Empty* /*request*/, ::grpc::ServerWriter< ::dra::Inputs>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::dra::Inputs>* StreamNewInput(
+      ::grpc::CallbackServerContext* /*context*/, const ::dra::Empty* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_StreamCondition : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_StreamCondition() {
+      ::grpc::Service::MarkMethodCallback(20,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::dra::Empty, ::dra::Conditions>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::dra::Empty* request) { return this->StreamCondition(context, request); }));
+    }
+    ~WithCallbackMethod_StreamCondition() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamCondition(::grpc::ServerContext* /*context*/, const ::dra::Empty* /*request*/, ::grpc::ServerWriter< ::dra::Conditions>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::dra::Conditions>* StreamCondition(
+      ::grpc::CallbackServerContext* /*context*/, const ::dra::Empty* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_SendDependencies : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_SendDependencies() {
+      ::grpc::Service::MarkMethodCallback(21,
+          new ::grpc::internal::CallbackClientStreamingHandler< ::dra::Dependency, ::dra::Empty>(
+            [this](
+                   ::grpc::CallbackServerContext* context, ::dra::Empty* response) { return this->SendDependencies(context, response); }));
+    }
+    ~WithCallbackMethod_SendDependencies() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SendDependencies(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::dra::Dependency>* /*reader*/, ::dra::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerReadReactor< ::dra::Dependency>* SendDependencies(
+      ::grpc::CallbackServerContext* /*context*/, ::dra::Empty* /*response*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_GetVMOffsets<WithCallbackMethod_SendNumberBasicBlock<WithCallbackMethod_SendNumberBasicBlockCovered<WithCallbackMethod_GetNewInput<WithCallbackMethod_SendDependency<WithCallbackMethod_GetCondition<WithCallbackMethod_SendWriteAddress<WithCallbackMethod_Connect<WithCallbackMethod_GetDataDependency<WithCallbackMethod_SendNewInput<WithCallbackMethod_GetTasks<WithCallbackMethod_GetBootTasks<WithCallbackMethod_ReturnTasks<WithCallbackMethod_SendBootInput<WithCallbackMethod_SendUnstableInput<WithCallbackMethod_SendLog<WithCallbackMethod_sendStat<WithCallbackMethod_GetNeed<WithCallbackMethod_SendNeedInput<WithCallbackMethod_StreamNewInput<WithCallbackMethod_StreamCondition<WithCallbackMethod_SendDependencies<Service > > > > > > > > > > > > > > > > > > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_GetVMOffsets : public BaseClass {
@@ -1752,6 +1971,57 @@ class DependencyRPC final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_StreamNewInput : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_StreamNewInput() {
+      ::grpc::Service::MarkMethodGeneric(19);
+    }
+    ~WithGenericMethod_StreamNewInput() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamNewInput(::grpc::ServerContext* /*context*/, const ::dra::Empty* /*request*/, ::grpc::ServerWriter< ::dra::Inputs>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_StreamCondition : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_StreamCondition() {
+      ::grpc::Service::MarkMethodGeneric(20);
+    }
+    ~WithGenericMethod_StreamCondition() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamCondition(::grpc::ServerContext* /*context*/, const ::dra::Empty* /*request*/, ::grpc::ServerWriter< ::dra::Conditions>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SendDependencies : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SendDependencies() {
+      ::grpc::Service::MarkMethodGeneric(21);
+    }
+    ~WithGenericMethod_SendDependencies() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SendDependencies(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::dra::Dependency>* /*reader*/, ::dra::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_GetVMOffsets : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -2132,6 +2402,66 @@ class DependencyRPC final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_StreamNewInput : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_StreamNewInput() {
+      ::grpc::Service::MarkMethodRaw(19);
+    }
+    ~WithRawMethod_StreamNewInput() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamNewInput(::grpc::ServerContext* /*context*/, const ::dra::Empty* /*request*/, ::grpc::ServerWriter< ::dra::Inputs>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStreamNewInput(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(19, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_StreamCondition : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_StreamCondition() {
+      ::grpc::Service::MarkMethodRaw(20);
+    }
+    ~WithRawMethod_StreamCondition() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamCondition(::grpc::ServerContext* /*context*/, const ::dra::Empty* /*request*/, ::grpc::ServerWriter< ::dra::Conditions>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStreamCondition(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(20, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SendDependencies : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SendDependencies() {
+      ::grpc::Service::MarkMethodRaw(21);
+    }
+    ~WithRawMethod_SendDependencies() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SendDependencies(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::dra::Dependency>* /*reader*/, ::dra::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSendDependencies(::grpc::ServerContext* context, ::grpc::ServerAsyncReader< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* reader, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncClientStreaming(21, context, reader, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_GetVMOffsets : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -2550,6 +2880,72 @@ class DependencyRPC final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_StreamNewInput : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_StreamNewInput() {
+      ::grpc::Service::MarkMethodRawCallback(19,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->StreamNewInput(context, request); }));
+    }
+    ~WithRawCallbackMethod_StreamNewInput() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamNewInput(::grpc::ServerContext* /*context*/, const ::dra::Empty* /*request*/, ::grpc::ServerWriter< ::dra::Inputs>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* StreamNewInput(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_StreamCondition : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_StreamCondition() {
+      ::grpc::Service::MarkMethodRawCallback(20,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->StreamCondition(context, request); }));
+    }
+    ~WithRawCallbackMethod_StreamCondition() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamCondition(::grpc::ServerContext* /*context*/, const ::dra::Empty* /*request*/, ::grpc::ServerWriter< ::dra::Conditions>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* StreamCondition(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SendDependencies : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SendDependencies() {
+      ::grpc::Service::MarkMethodRawCallback(21,
+          new ::grpc::internal::CallbackClientStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, ::grpc::ByteBuffer* response) { return this->SendDependencies(context, response); }));
+    }
+    ~WithRawCallbackMethod_SendDependencies() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SendDependencies(::grpc::ServerContext* /*context*/, ::grpc::ServerReader< ::dra::Dependency>* /*reader*/, ::dra::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerReadReactor< ::grpc::ByteBuffer>* SendDependencies(
+      ::grpc::CallbackServerContext* /*context*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_GetVMOffsets : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -3063,8 +3459,62 @@ class DependencyRPC final {
     virtual ::grpc::Status StreamedSendNeedInput(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::dra::Input,::dra::Empty>* server_unary_streamer) = 0;
   };
   typedef WithStreamedUnaryMethod_GetVMOffsets<WithStreamedUnaryMethod_SendNumberBasicBlock<WithStreamedUnaryMethod_SendNumberBasicBlockCovered<WithStreamedUnaryMethod_GetNewInput<WithStreamedUnaryMethod_SendDependency<WithStreamedUnaryMethod_GetCondition<WithStreamedUnaryMethod_SendWriteAddress<WithStreamedUnaryMethod_Connect<WithStreamedUnaryMethod_GetDataDependency<WithStreamedUnaryMethod_SendNewInput<WithStreamedUnaryMethod_GetTasks<WithStreamedUnaryMethod_GetBootTasks<WithStreamedUnaryMethod_ReturnTasks<WithStreamedUnaryMethod_SendBootInput<WithStreamedUnaryMethod_SendUnstableInput<WithStreamedUnaryMethod_SendLog<WithStreamedUnaryMethod_sendStat<WithStreamedUnaryMethod_GetNeed<WithStreamedUnaryMethod_SendNeedInput<Service > > > > > > > > > > > > > > > > > > > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_GetVMOffsets<WithStreamedUnaryMethod_SendNumberBasicBlock<WithStreamedUnaryMethod_SendNumberBasicBlockCovered<WithStreamedUnaryMethod_GetNewInput<WithStreamedUnaryMethod_SendDependency<WithStreamedUnaryMethod_GetCondition<WithStreamedUnaryMethod_SendWriteAddress<WithStreamedUnaryMethod_Connect<WithStreamedUnaryMethod_GetDataDependency<WithStreamedUnaryMethod_SendNewInput<WithStreamedUnaryMethod_GetTasks<WithStreamedUnaryMethod_GetBootTasks<WithStreamedUnaryMethod_ReturnTasks<WithStreamedUnaryMethod_SendBootInput<WithStreamedUnaryMethod_SendUnstableInput<WithStreamedUnaryMethod_SendLog<WithStreamedUnaryMethod_sendStat<WithStreamedUnaryMethod_GetNeed<WithStreamedUnaryMethod_SendNeedInput<Service > > > > > > > > > > > > > > > > > > > StreamedService;
+  template <class BaseClass>
+  class WithSplitStreamingMethod_StreamNewInput : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_StreamNewInput() {
+      ::grpc::Service::MarkMethodStreamed(19,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::dra::Empty, ::dra::Inputs>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::dra::Empty, ::dra::Inputs>* streamer) {
+                       return this->StreamedStreamNewInput(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_StreamNewInput() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status StreamNewInput(::grpc::ServerContext* /*context*/, const ::dra::Empty* /*request*/, ::grpc::ServerWriter< ::dra::Inputs>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedStreamNewInput(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::dra::Empty,::dra::Inputs>* server_split_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithSplitStreamingMethod_StreamCondition : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_StreamCondition() {
+      ::grpc::Service::MarkMethodStreamed(20,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::dra::Empty, ::dra::Conditions>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::dra::Empty, ::dra::Conditions>* streamer) {
+                       return this->StreamedStreamCondition(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_StreamCondition() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status StreamCondition(::grpc::ServerContext* /*context*/, const ::dra::Empty* /*request*/, ::grpc::ServerWriter< ::dra::Conditions>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedStreamCondition(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::dra::Empty,::dra::Conditions>* server_split_streamer) = 0;
+  };
+  typedef WithSplitStreamingMethod_StreamNewInput<WithSplitStreamingMethod_StreamCondition<Service > > SplitStreamedService;
+  typedef WithStreamedUnaryMethod_GetVMOffsets<WithStreamedUnaryMethod_SendNumberBasicBlock<WithStreamedUnaryMethod_SendNumberBasicBlockCovered<WithStreamedUnaryMethod_GetNewInput<WithStreamedUnaryMethod_SendDependency<WithStreamedUnaryMethod_GetCondition<WithStreamedUnaryMethod_SendWriteAddress<WithStreamedUnaryMethod_Connect<WithStreamedUnaryMethod_GetDataDependency<WithStreamedUnaryMethod_SendNewInput<WithStreamedUnaryMethod_GetTasks<WithStreamedUnaryMethod_GetBootTasks<WithStreamedUnaryMethod_ReturnTasks<WithStreamedUnaryMethod_SendBootInput<WithStreamedUnaryMethod_SendUnstableInput<WithStreamedUnaryMethod_SendLog<WithStreamedUnaryMethod_sendStat<WithStreamedUnaryMethod_GetNeed<WithStreamedUnaryMethod_SendNeedInput<WithSplitStreamingMethod_StreamNewInput<WithSplitStreamingMethod_StreamCondition<Service > > > > > > > > > > > > > > > > > > > > > StreamedService;
 };
 
 }  // namespace dra
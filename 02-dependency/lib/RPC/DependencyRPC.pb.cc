@@ -275,7 +275,7 @@ const char descriptor_table_protodef_DependencyRPC_2eproto[] PROTOBUF_SECTION_VA
   "sks\022\032\n\006return\030\014 \001(\0132\n.dra.Tasks\022\035\n\thigh_"
   "task\030\r \001(\0132\n.dra.Tasks\022\035\n\tboot_task\030\024 \001("
   "\0132\n.dra.Tasks\022\037\n\013return_boot\030\025 \001(\0132\n.dra"
-  ".Tasks2\346\006\n\rDependencyRPC\022(\n\014GetVMOffsets"
+  ".Tasks2\376\007\n\rDependencyRPC\022(\n\014GetVMOffsets"
   "\022\n.dra.Empty\032\n.dra.Empty\"\000\0220\n\024SendNumber"
   "BasicBlock\022\n.dra.Empty\032\n.dra.Empty\"\000\0227\n\033"
   "SendNumberBasicBlockCovered\022\n.dra.Empty\032"
@@ -296,8 +296,12 @@ const char descriptor_table_protodef_DependencyRPC_2eproto[] PROTOBUF_SECTION_VA
   "\022#\n\007SendLog\022\n.dra.Empty\032\n.dra.Empty\"\000\022(\n"
   "\010sendStat\022\016.dra.Statistic\032\n.dra.Empty\"\000\022"
   "#\n\007GetNeed\022\n.dra.Empty\032\n.dra.Empty\"\000\022)\n\r"
-  "SendNeedInput\022\n.dra.Input\032\n.dra.Empty\"\000B"
-  "\007Z\005.;drab\006proto3"
+  "SendNeedInput\022\n.dra.Input\032\n.dra.Empty\"\000\022"
+  "-\n\016StreamNewInput\022\n.dra.Empty\032\013.dra.Inpu"
+  "ts\"\0000\001\0222\n\017StreamCondition\022\n.dra.Empty\032\017."
+  "dra.Conditions\"\0000\001\0223\n\020SendDependencies\022\017"
+  ".dra.Dependency\032\n.dra.Empty\"\000(\001B\007Z\005.;dra"
+  "b\006proto3"
   ;
 static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_DependencyRPC_2eproto_deps[5] = {
   &::descriptor_table_Base_2eproto,
@@ -308,7 +312,7 @@ static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor
 };
 static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_DependencyRPC_2eproto_once;
 const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_DependencyRPC_2eproto = {
-  false, false, 1976, descriptor_table_protodef_DependencyRPC_2eproto, "DependencyRPC.proto", 
+  false, false, 2128, descriptor_table_protodef_DependencyRPC_2eproto, "DependencyRPC.proto", 
   &descriptor_table_DependencyRPC_2eproto_once, descriptor_table_DependencyRPC_2eproto_deps, 5, 9,
   schemas, file_default_instances, TableStruct_DependencyRPC_2eproto::offsets,
   file_level_metadata_DependencyRPC_2eproto, file_level_enum_descriptors_DependencyRPC_2eproto, file_level_service_descriptors_DependencyRPC_2eproto,
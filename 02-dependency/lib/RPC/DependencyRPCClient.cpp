@@ -14,10 +14,12 @@
 namespace dra {
 
     DependencyRPCClient::DependencyRPCClient(const std::shared_ptr<grpc::Channel> &channel) :
-            stub_(DependencyRPC::NewStub(channel)) {
+            stub_(DependencyRPC::NewStub(channel)), dependency_mode(DependencyMode::unknown), dependency_bytes(0) {
     }
 
-    DependencyRPCClient::~DependencyRPCClient() = default;
+    DependencyRPCClient::~DependencyRPCClient() {
+        this->FlushDependencies();
+    }
 
 
     uint32_t DependencyRPCClient::GetVmOffsets() {
@@ -61,6 +63,20 @@ namespace dra {
         }
     }
 
+    void DependencyRPCClient::SendLog(const std::string &log) {
+        Empty request;
+        Empty reply;
+        grpc::ClientContext context;
+        request.set_name(log);
+        grpc::Status status = stub_->SendLog(&context, request, &reply);
+        if (status.ok()) {
+            return;
+        } else {
+            std::cerr << status.error_code() << ": " << status.error_message() << std::endl;
+            return;
+        }
+    }
+
     Inputs *DependencyRPCClient::GetNewInput() {
         Empty request;
         auto *reply = new Inputs();
@@ -115,4 +131,96 @@ namespace dra {
         return reply;
     }
 
+    grpc::Status DependencyRPCClient::StreamNewInput(grpc::ClientContext *context,
+                                                     const std::function<void(Inputs *)> &f) {
+        Empty request;
+        std::unique_ptr<grpc::ClientReader<Inputs>> reader(stub_->StreamNewInput(context, request));
+        for (;;) {
+            auto *reply = new Inputs();
+            if (!reader->Read(reply)) {
+                delete reply;
+                break;
+            }
+            f(reply);
+        }
+        return reader->Finish();
+    }
+
+    grpc::Status DependencyRPCClient::StreamCondition(grpc::ClientContext *context,
+                                                      const std::function<void(Conditions *)> &f) {
+        Empty request;
+        std::unique_ptr<grpc::ClientReader<Conditions>> reader(stub_->StreamCondition(context, request));
+        for (;;) {
+            auto *reply = new Conditions();
+            if (!reader->Read(reply)) {
+                delete reply;
+                break;
+            }
+            f(reply);
+        }
+        return reader->Finish();
+    }
+
+    void DependencyRPCClient::AddDependency(Dependency *request) {
+        if (dependency_mode == DependencyMode::unary) {
+            delete SendDependency(*request);
+            delete request;
+            return;
+        }
+        if (dependency_writer == nullptr) {
+            dependency_context.reset(new grpc::ClientContext());
+            dependency_reply.Clear();
+            dependency_writer = stub_->SendDependencies(dependency_context.get(), &dependency_reply);
+            dependency_bytes = 0;
+            dependency_flushed = std::chrono::steady_clock::now();
+        }
+
+        //buffer the write unless the batch is full or old enough
+        grpc::WriteOptions options;
+        auto now = std::chrono::steady_clock::now();
+        dependency_bytes += request->ByteSizeLong();
+        if (dependency_bytes < DEPENDENCY_BATCH_BYTES &&
+            now - dependency_flushed < std::chrono::milliseconds(DEPENDENCY_BATCH_MS)) {
+            options.set_buffer_hint();
+        } else {
+            dependency_bytes = 0;
+            dependency_flushed = now;
+        }
+        bool ok = dependency_writer->Write(*request, options);
+        if (dependency_mode == DependencyMode::unknown) {
+            dependency_kept.emplace_back(request);
+        } else {
+            delete request;
+        }
+        if (!ok) {
+            this->FinishDependencies();
+        }
+    }
+
+    void DependencyRPCClient::FlushDependencies() {
+        if (dependency_writer == nullptr) {
+            return;
+        }
+        dependency_writer->WritesDone();
+        this->FinishDependencies();
+    }
+
+    void DependencyRPCClient::FinishDependencies() {
+        grpc::Status status = dependency_writer->Finish();
+        dependency_writer.reset();
+        dependency_context.reset();
+        if (status.ok()) {
+            dependency_mode = DependencyMode::stream;
+        } else if (status.error_code() == grpc::StatusCode::UNIMPLEMENTED &&
+                   dependency_mode == DependencyMode::unknown) {
+            dependency_mode = DependencyMode::unary;
+            for (auto &d : dependency_kept) {
+                delete SendDependency(*d);
+            }
+        } else {
+            std::cerr << status.error_code() << ": " << status.error_message() << std::endl;
+        }
+        dependency_kept.clear();
+    }
+
 } /* namespace dra */
@@ -8,12 +8,19 @@
 #ifndef LIB_RPC_DEPENDENCYRPCCLIENT_H_
 #define LIB_RPC_DEPENDENCYRPCCLIENT_H_
 
+#include <chrono>
+#include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 #include <grpcpp/channel.h>
 
 #include "DependencyRPC.grpc.pb.h"
 
 #define DEBUG_RPC 0
+//the dependencies buffered on the SendDependencies stream are flushed every so many bytes or milliseconds
+#define DEPENDENCY_BATCH_BYTES (4 << 20)
+#define DEPENDENCY_BATCH_MS 100
 
 namespace dra {
 
@@ -29,6 +36,9 @@ namespace dra {
 
         void SendNumberBasicBlockCovered(uint32_t NumberBasicBlockCovered);
 
+        //Append to the log of the manager.
+        void SendLog(const std::string &log);
+
         Inputs *GetNewInput();
 
         Empty *SendDependency(const Dependency &request);
@@ -37,10 +47,39 @@ namespace dra {
 
         Empty *SendWriteAddress(const WriteAddresses &request);
 
+        //Block and hand every Inputs the server pushes to f, which owns it, until the stream ends
+        //or the context is cancelled. UNIMPLEMENTED if the server only has GetNewInput.
+        grpc::Status StreamNewInput(grpc::ClientContext *context, const std::function<void(Inputs *)> &f);
+
+        //The same for the conditions, UNIMPLEMENTED if the server only has GetCondition.
+        grpc::Status StreamCondition(grpc::ClientContext *context, const std::function<void(Conditions *)> &f);
+
+        //Write a dependency, which it owns, to the SendDependencies stream of the current input, buffered
+        //and flushed by DEPENDENCY_BATCH_BYTES and DEPENDENCY_BATCH_MS. Falls back to SendDependency if
+        //the server has no SendDependencies.
+        void AddDependency(Dependency *request);
+
+        //End the stream of the current input and wait for the server to take all its dependencies.
+        void FlushDependencies();
+
         Empty *Check() { return new Empty(); }
 
     private:
+        void FinishDependencies();
+
         std::unique_ptr<DependencyRPC::Stub> stub_;
+
+        enum class DependencyMode {
+            unknown, stream, unary
+        };
+        DependencyMode dependency_mode;
+        std::unique_ptr<grpc::ClientContext> dependency_context;
+        std::unique_ptr<grpc::ClientWriter<Dependency>> dependency_writer;
+        Empty dependency_reply;
+        //kept to resend by SendDependency until a stream succeeds
+        std::vector<std::unique_ptr<Dependency>> dependency_kept;
+        uint64_t dependency_bytes;
+        std::chrono::steady_clock::time_point dependency_flushed;
     };
 
 } /* namespace dra */
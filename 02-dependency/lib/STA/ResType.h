@@ -1,10 +1,12 @@
 #ifndef _H_RESTYPE
 #define _H_RESTYPE
 
+#include <cstdint>
 #include <set>
 #include <map>
 #include <vector>
 #include <string>
+#include <tuple>
 
 //Here some types used for static analysis result data exchange.
 //They are defined like some SQL DB tables, some primary keys (e.g. taint tag id) are shared acorss tables.
@@ -63,4 +65,15 @@ typedef std::map<ID_TY,TRAIT> INST_TRAIT_MAP;
 //callee name -> MOD_IR_TY of this call inst
 typedef std::map<std::string,MOD_IR_TY> CALLEE_MAP_TY;
 
+//All the tables of a taint_info file, in the order of the file.
+struct TAINT_INFO {
+    TAINTED_BR_TY taintedBrs;
+    CTX_MAP_TY ctxMap;
+    INST_TRAIT_MAP traitMap;
+    TAG_MOD_MAP_TY tagModMap;
+    TAG_CONST_MAP_TY tagConstMap;
+    TAG_INFO_TY tagInfo;
+    CALLEE_MAP_TY calleeMap;
+};
+
 #endif
@@ -6,7 +6,12 @@
 
 #include "StaticAnalysisResult.h"
 #include "../DCC/general.h"
+#include "../DMM/DSymbol.h"
 
+#include <sys/resource.h>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 
 #define DEBUG_TIME 0
@@ -15,23 +20,51 @@
 
 namespace sta {
 
-    StaticAnalysisResult::~StaticAnalysisResult() = default;
+    StaticAnalysisResult::~StaticAnalysisResult() {
+        //The pool owns the sites, the lists only point into it.
+        for (auto &x : this->modInstPool) {
+            delete x.second;
+        }
+        for (auto &x : this->modBBPool) {
+            delete x.second;
+        }
+        for (auto &x : this->dom_map) {
+            delete x.second;
+        }
+    }
 
     int StaticAnalysisResult::initStaticRes(const std::string &staticRes, dra::DataManagement *DM) {
+        auto start = std::chrono::steady_clock::now();
+        if (this->readStaticRes(staticRes, DM)) {
+            return 1;
+        }
+        this->buildLocationIndex();
+
+        std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+        struct rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        dra::outputTime("static analysis results : " + std::to_string(d.count()) + " s, peak RSS : " +
+                        std::to_string(usage.ru_maxrss / 1024) + " MB");
+        return 0;
+    }
+
+    int StaticAnalysisResult::readStaticRes(const std::string &staticRes, dra::DataManagement *DM, uint32_t thread) {
         this->dm = DM;
         this->p_module = DM->Modules->module.get();
         try {
-            std::ifstream infile;
-            infile.open(staticRes);
-            infile >> this->j_taintedBrs >> this->j_ctxMap >> this->j_traitMap >> this->j_tagModMap
-                   >> this->j_tagConstMap >> this->j_tagInfo >> this->j_calleeMap;
-            infile.close();
-            this->taintedBrs = this->j_taintedBrs.get<TAINTED_BR_TY>();
-            this->ctxMap = this->j_ctxMap.get<CTX_MAP_TY>();
-            this->traitMap = this->j_traitMap.get<INST_TRAIT_MAP>();
-            this->tagModMap = this->j_tagModMap.get<TAG_MOD_MAP_TY>();
-            this->tagConstMap = this->j_tagConstMap.get<TAG_CONST_MAP_TY>();
-            this->tagInfo = this->j_tagInfo.get<TAG_INFO_TY>();
+            // the compiled form of t2b or the json form, which is streamed without keeping a json DOM
+            TAINT_INFO info;
+            if (!TaintFile::read(staticRes, info, thread)) {
+                std::cout << "Fail to deserialize the static analysis results!\n";
+                return 1;
+            }
+            this->taintedBrs = std::move(info.taintedBrs);
+            this->ctxMap = std::move(info.ctxMap);
+            this->traitMap = std::move(info.traitMap);
+            this->tagModMap = std::move(info.tagModMap);
+            this->tagConstMap = std::move(info.tagConstMap);
+            this->tagInfo = std::move(info.tagInfo);
+            this->calleeMap = std::move(info.calleeMap);
             //Sort the tag info into two separate maps" global and local (e.g. user provided arg)
             for (auto &x : this->tagInfo) {
                 if (x.second.find("is_global") != x.second.end() && x.second["is_global"] == "false") {
@@ -42,7 +75,7 @@ namespace sta {
             }
             //Group the same-typed tags.
             this->setupTagGroups();
-            this->calleeMap = this->j_calleeMap.get<CALLEE_MAP_TY>();
+            this->buildCalleeIndex();
             return 0;
         } catch (...) {
             std::cout << "Fail to deserialize the static analysis results!\n";
@@ -195,39 +228,38 @@ namespace sta {
             std::cout << "QueryBranchTaint : p_loc = nullptr" << std::endl;
             return nullptr;
         }
+        BR_INF *res = nullptr;
         auto &res3 = this->taintedBrs;
-        if (res3.find((*p_loc)[3]) != res3.end()) {
+        auto it3 = res3.find((*p_loc)[3]);
+        if (it3 != res3.end()) {
 //            std::cout << "QueryBranchTaint : find path : " << (*p_loc)[3] << std::endl;
-            auto &res2 = res3[(*p_loc)[3]];
-            if (res2.find((*p_loc)[2]) != res2.end()) {
+            auto &res2 = it3->second;
+            auto it2 = res2.find((*p_loc)[2]);
+            if (it2 != res2.end()) {
 //                std::cout << "QueryBranchTaint : find function : " << (*p_loc)[2] << std::endl;
-                auto &res1 = res2[(*p_loc)[2]];
-                if (res1.find((*p_loc)[1]) != res1.end()) {
+                auto &res1 = it2->second;
+                auto it1 = res1.find((*p_loc)[1]);
+                if (it1 != res1.end()) {
 //                    std::cout << "QueryBranchTaint : find bb : " << (*p_loc)[1] << std::endl;
-                    return &(res1[(*p_loc)[1]]);
+                    res = &(it1->second);
                 }
             }
         }
-//        std::cout << "QueryBranchTaint : return = nullptr : out side analysis" << std::endl;
-        return nullptr;
+        delete p_loc;
+//        if (!res) std::cout << "QueryBranchTaint : return = nullptr : out side analysis" << std::endl;
+        return res;
     }
 
-    //Whatever call context under which the br is tainted, we will contain its mod insts for any tags (i.e. ALL).
-    MODS *StaticAnalysisResult::GetAllGlobalWriteInsts(llvm::BasicBlock *B, unsigned int branch_id) {
-        BR_INF *p_taint_inf = this->QueryBranchTaint(B);
-        if (!p_taint_inf) {
-            std::cout << "GetAllGlobalWriteInsts : p_taint_inf = nullptr" << std::endl;
-            return nullptr;
-        }
-        MODS *p_mod_irs = new MODS();
-        //TODO: we assume now the trait for the "br" remains the same even under different contexts.
-        ID_TY trait_id = 0;
+    //The mods of every tag come from the pool, the result only holds the views with the ranking for this branch.
+    //The same mod of two tags is kept once, by its first tag.
+    MODS *StaticAnalysisResult::collectMods(BR_INF *p_taint_inf, bool bbs, ID_TY *trait_id) {
+        MODS *pmods = new MODS();
+        std::unordered_set<const llvm::Value *> seen;
         //Iterate over different contexts of "br".
         for (auto &x : *p_taint_inf) {
-            auto &actx_id = x.first;
-            trait_id = std::get<0>(x.second);
+            //TODO: we assume now the trait for the "br" remains the same even under different contexts.
+            *trait_id = std::get<0>(x.second);
             auto &tag_ids = std::get<1>(x.second);
-            //TODO: Consider all the tags w/ the same type.
             std::set<ID_TY> tag_ids_extend = tag_ids;
 #ifdef ENABLE_TAG_GROUP
             //Consider all the tags w/ the same type.
@@ -243,22 +275,38 @@ namespace sta {
                 if (this->tagInfo_local.find(tid) != this->tagInfo_local.end()) {
                     continue;
                 }
-                if (this->tagModMap.find(tid) == this->tagModMap.end()) {
+                auto it = this->tagModMap.find(tid);
+                if (it == this->tagModMap.end()) {
                     continue;
                 }
-                MOD_IR_TY *ps_mod_irs = &(this->tagModMap[tid]);
-                MODS *p_cur_mod_irs = this->GetRealModIrs(ps_mod_irs);
-
+                //TODO: for BBs this can be problematic, since one BB can contain two different insts that update different global states and have different traits.
+                //TODO: maybe we should deprecate GetAllGlobalWriteBBs and use GetAllGlobalWriteInsts instead.
+                const MOD_SITES *sites = bbs ? this->GetRealModBbs(&it->second) : this->GetRealModIrs(&it->second);
                 //Append the list.
-                for (auto &x : *p_cur_mod_irs) {
-                    if (std::find_if(p_mod_irs->begin(), p_mod_irs->end(), [x](const Mod *m) {
-                        return x->equal(m);
-                    }) == p_mod_irs->end()) {
-                        p_mod_irs->push_back(x);
+                for (ModSite *site : *sites) {
+                    if (seen.insert(site->key()).second) {
+                        pmods->push_back(new Mod(site));
+                    } else if (!site->pooled) {
+                        delete site;
                     }
                 }
+                if (!this->useModPool) {
+                    delete sites;
+                }
             }//tags
         }
+        return pmods;
+    }
+
+    //Whatever call context under which the br is tainted, we will contain its mod insts for any tags (i.e. ALL).
+    MODS *StaticAnalysisResult::GetAllGlobalWriteInsts(llvm::BasicBlock *B, unsigned int branch_id) {
+        BR_INF *p_taint_inf = this->QueryBranchTaint(B);
+        if (!p_taint_inf) {
+            std::cout << "GetAllGlobalWriteInsts : p_taint_inf = nullptr" << std::endl;
+            return nullptr;
+        }
+        ID_TY trait_id = 0;
+        MODS *p_mod_irs = this->collectMods(p_taint_inf, false, &trait_id);
         //According to the traits of both "br" and "store", pick out and rank the suitable mod IRs.
         //Also do some function name pair NLP analysis here.
         llvm::Instruction *inst = B->getTerminator();
@@ -276,47 +324,8 @@ namespace sta {
         if (!p_taint_inf || p_taint_inf->size() == 0) {
             return nullptr;
         }
-        MODS *p_mod_bbs = new MODS();
-        //TODO: we assume now the trait for the "br" remains the same even under different contexts.
         ID_TY trait_id = 0;
-        //Iterate over different contexts of "br".
-        for (auto &x : *p_taint_inf) {
-            auto &actx_id = x.first;
-            trait_id = std::get<0>(x.second);
-            auto &tag_ids = std::get<1>(x.second);
-            std::set<ID_TY> tag_ids_extend = tag_ids;
-#ifdef ENABLE_TAG_GROUP
-            //Consider all the tags w/ the same type.
-            for (ID_TY tid : tag_ids) {
-                const std::set<ID_TY> *tagGrp = this->getSameTypedTags(tid);
-                if (tagGrp) {
-                    tag_ids_extend.insert(tagGrp->begin(), tagGrp->end());
-                }
-            }
-#endif
-            for (ID_TY tid : tag_ids_extend) {
-                //Only consider the mod insts for global taint source.
-                if (this->tagInfo_local.find(tid) != this->tagInfo_local.end()) {
-                    continue;
-                }
-                if (this->tagModMap.find(tid) == this->tagModMap.end()) {
-                    continue;
-                }
-                MOD_IR_TY *ps_mod_irs = &(this->tagModMap[tid]);
-                MODS *p_cur_mod_bbs = this->GetRealModBbs(ps_mod_irs);
-
-                //Append the list.
-                //TODO: this can be problematic, since one BB can contain two different insts that update different global states and have different traits.
-                //TODO: maybe we should deprecate GetAllGlobalWriteBBs and use GetAllGlobalWriteInsts instead.
-                for (auto &x : *p_cur_mod_bbs) {
-                    if (std::find_if(p_mod_bbs->begin(), p_mod_bbs->end(), [x](const Mod *m) {
-                        return x->equal(m);
-                    }) == p_mod_bbs->end()) {
-                        p_mod_bbs->push_back(x);
-                    }
-                }
-            }//tags
-        }
+        MODS *p_mod_bbs = this->collectMods(p_taint_inf, true, &trait_id);
         //According to the traits of both "br" and "store", pick out and rank the suitable mod IRs.
         //Also do some function name pair NLP analysis here.
         llvm::Instruction *inst = B->getTerminator();
@@ -331,54 +340,151 @@ namespace sta {
         return p_mod_bbs;
     }
 
-    //NOTE: this will be inclusive (the successor list also contains the root BB.)
-    void StaticAnalysisResult::_get_all_successors(llvm::BasicBlock *bb, std::set<llvm::BasicBlock*> &res) {
-        if (!bb || res.find(bb) != res.end()) {
-            return;
-        }
-        //A result cache.
-        if (this->succ_map.find(bb) != this->succ_map.end()) {
-            res.insert(this->succ_map[bb].begin(),this->succ_map[bb].end());
+    std::vector<MODS *>
+    StaticAnalysisResult::GetAllGlobalWriteBBs(const std::vector<std::pair<llvm::BasicBlock *, unsigned int>> &queries,
+                                               uint32_t thread) {
+        std::vector<MODS *> res(queries.size(), nullptr);
+        if (thread == 0) {
+            thread = dra::number_thread();
+        }
+        //Without the index the location strings are resolved per query, which may materialize the functions.
+        if (!this->useLocationIndex) {
+            thread = 1;
+        }
+        dra::parallel_for(queries.size(), thread, [&](uint64_t i) {
+            res[i] = this->GetAllGlobalWriteBBs(queries[i].first, queries[i].second);
+        });
+        return res;
+    }
+
+    void StaticAnalysisResult::releaseMods(MODS *pmods) {
+        if (!pmods) {
             return;
         }
-        //inclusive
-        res.insert(bb);
-        for (llvm::succ_iterator sit = llvm::succ_begin(bb), set = llvm::succ_end(bb); sit != set; ++sit) {
-            this->_get_all_successors(*sit,res);
+        for (Mod *m : *pmods) {
+            delete m;
         }
-        return;
+        delete pmods;
     }
 
     //NOTE: this will be inclusive (the successor list also contains the root BB.)
-    std::set<llvm::BasicBlock*> *StaticAnalysisResult::get_all_successors(llvm::BasicBlock *bb) {
-        if (!bb) {
+    const llvm::BitVector *StaticAnalysisResult::BlockReach::get_all_successors(const llvm::BasicBlock *bb) const {
+        auto it = this->Ordinal.find(bb);
+        if (it == this->Ordinal.end()) {
+            return nullptr;
+        }
+        return &this->Reach[this->Component[it->second]];
+    }
+
+    bool StaticAnalysisResult::BlockReach::contains(const llvm::BitVector &bits, const llvm::BasicBlock *bb) const {
+        auto it = this->Ordinal.find(bb);
+        return it != this->Ordinal.end() && it->second < bits.size() && bits.test(it->second);
+    }
+
+    //Tarjan's algorithm without recursion, a component is finished after all the components reachable from it,
+    //so its bits are its own BBs and the bits of the components its edges lead to.
+    const StaticAnalysisResult::BlockReach *StaticAnalysisResult::getBlockReach(llvm::Function *F) {
+        if (!F) {
             return nullptr;
         }
-        //A result cache.
-        if (this->succ_map.find(bb) != this->succ_map.end()) {
-            return &this->succ_map[bb];
+        std::lock_guard<std::mutex> guard(this->reachLock);
+        std::unique_ptr<BlockReach> &r = this->reach_map[F];
+        if (r) {
+            return r.get();
+        }
+        r.reset(new BlockReach());
+        const uint32_t None = UINT32_MAX;
+        for (auto &b : *F) {
+            r->Ordinal[&b] = r->Blocks.size();
+            r->Blocks.push_back(&b);
+        }
+        const uint32_t n = r->Blocks.size();
+        std::vector<std::vector<uint32_t>> succs(n);
+        for (uint32_t k = 0; k < n; k++) {
+            for (llvm::succ_iterator sit = llvm::succ_begin(r->Blocks[k]), set = llvm::succ_end(r->Blocks[k]); sit != set; ++sit) {
+                succs[k].push_back(r->Ordinal[*sit]);
+            }
         }
-        std::set<llvm::BasicBlock*> res;
-        res.clear();
-        this->_get_all_successors(bb,res);
-        this->succ_map[bb] = res;
-        return &this->succ_map[bb];
+        r->Component.assign(n, None);
+        std::vector<uint32_t> index(n, None), low(n, 0), stack;
+        std::vector<bool> on_stack(n, false);
+        //(BB, next edge)
+        std::vector<std::pair<uint32_t, uint32_t>> dfs;
+        uint32_t next_index = 0;
+        for (uint32_t root = 0; root < n; root++) {
+            if (index[root] != None) {
+                continue;
+            }
+            dfs.emplace_back(root, 0);
+            index[root] = low[root] = next_index++;
+            stack.push_back(root);
+            on_stack[root] = true;
+            while (!dfs.empty()) {
+                uint32_t v = dfs.back().first;
+                uint32_t &e = dfs.back().second;
+                if (e < succs[v].size()) {
+                    uint32_t w = succs[v][e++];
+                    if (index[w] == None) {
+                        index[w] = low[w] = next_index++;
+                        stack.push_back(w);
+                        on_stack[w] = true;
+                        dfs.emplace_back(w, 0);
+                    } else if (on_stack[w]) {
+                        low[v] = std::min(low[v], index[w]);
+                    }
+                    continue;
+                }
+                dfs.pop_back();
+                if (!dfs.empty()) {
+                    uint32_t u = dfs.back().first;
+                    low[u] = std::min(low[u], low[v]);
+                }
+                if (low[v] != index[v]) {
+                    continue;
+                }
+                //v is the root of a component, which is on the top of the stack.
+                uint32_t c = r->Reach.size();
+                r->Reach.emplace_back(n);
+                llvm::BitVector &bits = r->Reach.back();
+                uint64_t first = stack.size();
+                do {
+                    first--;
+                    r->Component[stack[first]] = c;
+                    on_stack[stack[first]] = false;
+                    bits.set(stack[first]);
+                } while (stack[first] != v);
+                for (uint64_t k = first; k < stack.size(); k++) {
+                    for (uint32_t w : succs[stack[k]]) {
+                        if (r->Component[w] != c) {
+                            bits |= r->Reach[r->Component[w]];
+                        }
+                    }
+                }
+                stack.resize(first);
+            }
+        }
+        return r.get();
     }
 
     llvm::DominatorTree *StaticAnalysisResult::get_dom_tree(llvm::Function *pfunc) {
         if (!pfunc) {
             return nullptr;
         }
+        std::lock_guard<std::mutex> guard(this->domLock);
         if (this->dom_map.find(pfunc) == this->dom_map.end()) {
             llvm::DominatorTree *pdom = new llvm::DominatorTree(*pfunc);
+            //dominates() renumbers the tree after enough slow queries, number it here so that the
+            //queries of the batch workers only read it.
+            pdom->updateDFSNumbers();
             this->dom_map[pfunc] = pdom;
         }
         return this->dom_map[pfunc];
     }
 
-    void StaticAnalysisResult::getBranchSuccs(llvm::Instruction *inst, unsigned idx, std::set<llvm::BasicBlock*> &res) {
+    const StaticAnalysisResult::BlockReach *
+    StaticAnalysisResult::getBranchSuccs(llvm::Instruction *inst, unsigned idx, llvm::BitVector &res) {
         if (!inst) {
-            return;
+            return nullptr;
         }
         llvm::BranchInst *br_inst = llvm::dyn_cast<llvm::BranchInst>(inst);
         llvm::SwitchInst *sw_inst = llvm::dyn_cast<llvm::SwitchInst>(inst);
@@ -390,27 +496,32 @@ namespace sta {
         } else if (sw_inst) {
             n_succs = sw_inst->getNumSuccessors();
         } else {
-            return;
+            return nullptr;
         }
         if (idx >= n_succs) {
-            return;
+            return nullptr;
+        }
+        const BlockReach *reach = this->getBlockReach(inst->getFunction());
+        if (!reach) {
+            return nullptr;
         }
-        std::set<llvm::BasicBlock*> succ_this, succ_other;
+        llvm::BitVector succ_other(reach->Blocks.size());
+        res.clear();
+        res.resize(reach->Blocks.size());
         for (unsigned i = 0; i < n_succs; ++i) {
             llvm::BasicBlock *succ_bb = (br_inst ? br_inst->getSuccessor(i) : sw_inst->getSuccessor(i));
-            std::set<llvm::BasicBlock*> *succs = this->get_all_successors(succ_bb);
+            const llvm::BitVector *succs = reach->get_all_successors(succ_bb);
             if (!succs) {
                 continue;
             }
             if (i == idx) {
-                succ_this.insert(succs->begin(), succs->end());
+                res |= *succs;
             } else {
-                succ_other.insert(succs->begin(), succs->end());
+                succ_other |= *succs;
             }
         }
-        std::set_difference(succ_this.begin(), succ_this.end(), succ_other.begin(), succ_other.end(),
-                            std::inserter(res, res.end()));
-        return;
+        res.reset(succ_other);
+        return reach;
     }
 
     void StaticAnalysisResult::filterMods(MODS *pmods, llvm::BasicBlock *B, unsigned int branch_id) {
@@ -422,30 +533,35 @@ namespace sta {
             return;
         }
         //Get the successors only found for this "branch_id".
-        std::set<llvm::BasicBlock*> succ_uniq;
+        llvm::BitVector succ_uniq;
+        const BlockReach *reach = nullptr;
         if (llvm::dyn_cast<llvm::BranchInst>(inst) || llvm::dyn_cast<llvm::SwitchInst>(inst)) {
-            this->getBranchSuccs(inst,branch_id,succ_uniq);
+            reach = this->getBranchSuccs(inst,branch_id,succ_uniq);
         } else {
             return;
         }
         llvm::DominatorTree *pdom = this->get_dom_tree(B->getParent());
-        std::remove_if(pmods->begin(), pmods->end(),
-                       [succ_uniq, pdom, B](Mod *pmod) {
+        //The removed mods are freed, so that releaseMods frees every mod once.
+        auto end = std::remove_if(pmods->begin(), pmods->end(),
+                       [&succ_uniq, reach, pdom, B](Mod *pmod) {
                            if (!pmod->B) {
                                return false;
                            }
                            //Case 0: we need to satisfy the "br" to reach the mod inst...
-                           if (succ_uniq.find(pmod->B) != succ_uniq.end()) {
+                           if (reach && reach->contains(succ_uniq, pmod->B)) {
+                               delete pmod;
                                return true;
                            }
                            //Case 1: we can for sure reach the mod inst if we can reach the "br" and the mod inst is not accumulative (i.e. i++) 
                            if (pmod->B->getParent() == B->getParent() && pmod->is_trait_fixed() &&
                                pdom->dominates(pmod->B, B)) {
+                               delete pmod;
                                return true;
                            }
                            return false;
                        }
         );
+        pmods->erase(end, pmods->end());
     }
 
     void StaticAnalysisResult::tweakModsOnTraits(MODS *pmods, ID_TY br_trait_id, unsigned int branch_id) {
@@ -496,24 +612,25 @@ namespace sta {
                 //So we need to find the "antonym" function names.
                 //The heuristic is that antonym names are different but usually very similar to original names (e.g. de- and en-), so we can pick
                 //those callee names with low Levenshtein distances.
-                for (auto &x : this->calleeMap) {
-                    int dis = this->levDistance(br_func, x.first);
-                    //TODO: is "2" a proper threshold value?
-                    if (dis == 0 || dis > 2) {
-                        continue;
-                    }
+                //TODO: is "2" a proper threshold value?
+                std::vector<CALLEE_MAP_TY::value_type *> callees;
+                this->getSimilarCallees(br_func, 2, callees);
+                for (auto *x : callees) {
                     //Ok, we guess this is an antonym function that we should call.
                     //Get the callee instruction and treat is as a potential "Mod IR".
-                    MODS *p_callee_mods = this->GetRealModBbs(&x.second);
+                    const MOD_SITES *p_callee_mods = this->GetRealModBbs(&x->second);
                     if (!p_callee_mods) {
                         continue;
                     }
-                    //Set proper priorities and properties of these MOD IRs.
-                    for (auto &x : *p_callee_mods) {
-                        x->from_nlp = true;
+                    //Set proper priorities and properties of these MOD IRs, and append them to the original list.
+                    for (ModSite *site : *p_callee_mods) {
+                        Mod *pmod = new Mod(site);
+                        pmod->from_nlp = true;
+                        pmods->push_back(pmod);
+                    }
+                    if (!this->useModPool) {
+                        delete p_callee_mods;
                     }
-                    //Append these NLP Mod IRs to the original list.
-                    pmods->insert(pmods->end(), p_callee_mods->begin(), p_callee_mods->end());
                 }
             }
         }
@@ -525,26 +642,145 @@ namespace sta {
         //Rank the mod insts.
     }
 
-    MODS *StaticAnalysisResult::GetRealModIrs(MOD_IR_TY *p_mod_irs) {
+    ModSite *StaticAnalysisResult::getModSite(llvm::Instruction *I, const MOD_INF *p_mod_inf) {
+        if (!this->useModPool) {
+            auto *site = new ModSite(I, p_mod_inf, this);
+            site->pooled = false;
+            return site;
+        }
+        ModSite *&site = this->modInstPool[p_mod_inf];
+        if (!site) {
+            site = new ModSite(I, p_mod_inf, this);
+        }
+        return site;
+    }
+
+    ModSite *StaticAnalysisResult::getModSite(const BB_MOD_TY *insts, llvm::BasicBlock *B, const MOD_INF *p_mod_inf) {
+        ModSite *site = nullptr;
+        if (!this->useModPool) {
+            site = new ModSite(B, p_mod_inf, this);
+            site->pooled = false;
+        } else {
+            ModSite *&pooled = this->modBBPool[insts];
+            if (pooled) {
+                return pooled;
+            }
+            site = pooled = new ModSite(B, p_mod_inf, this);
+        }
+        auto id = this->modBBID.find(insts);
+        if (id != this->modBBID.end()) {
+            site->id = id->second;
+        }
+        return site;
+    }
+
+    ModSite *StaticAnalysisResult::getModSiteByID(uint32_t id) {
+        if (id >= this->modBBOrder.size()) {
+            return nullptr;
+        }
+        const BB_MOD_TY *insts = this->modBBOrder[id];
+        auto it = this->modBBIndex.find(insts);
+        if (it == this->modBBIndex.end() || !it->second.first || !it->second.second) {
+            return nullptr;
+        }
+        std::lock_guard<std::mutex> guard(this->poolLock);
+        return this->getModSite(insts, it->second.first, it->second.second);
+    }
+
+    bool StaticAnalysisResult::loadWriteTable(const std::string &path, const uint64_t key[2]) {
+        this->hasWriteTable = this->writeTable.open(path, key, this->modBBOrder.size());
+        return this->hasWriteTable;
+    }
+
+    bool StaticAnalysisResult::writeWriteTable(const std::string &path, const uint64_t key[2],
+                                               const std::vector<uint64_t> &addresses,
+                                               const std::vector<std::pair<llvm::BasicBlock *, unsigned int>> &queries,
+                                               const std::vector<MODS *> &res) {
+        std::vector<WriteTable::Condition> conditions;
+        std::vector<WriteTable::Mod> mods;
+        conditions.reserve(queries.size());
+        for (uint64_t i = 0; i < queries.size(); i++) {
+            WriteTable::Condition c{addresses[i], queries[i].second, -1, mods.size()};
+            if (res[i]) {
+                c.number = 0;
+                for (Mod *m : *res[i]) {
+                    //Only the mod BBs of the loaded tables have an id, which is all of GetAllGlobalWriteBBs.
+                    if (m->site->id == ModSite::NO_ID) {
+                        continue;
+                    }
+                    WriteTable::Mod w{m->site->id, m->prio, m->repeat, m->from_nlp, 0};
+                    mods.push_back(w);
+                    c.number++;
+                }
+            }
+            conditions.push_back(c);
+        }
+        return WriteTable::write(path, key, this->modBBOrder.size(), conditions, mods);
+    }
+
+    MODS *StaticAnalysisResult::lookupWriteBBs(uint64_t address, unsigned int branch, bool *found) {
+        *found = false;
+        if (!this->hasWriteTable) {
+            return nullptr;
+        }
+        const WriteTable::Condition *c = this->writeTable.find(address, branch);
+        if (!c) {
+            return nullptr;
+        }
+        *found = true;
+        if (c->number < 0) {
+            return nullptr;
+        }
+        MODS *pmods = new MODS();
+        pmods->reserve(c->number);
+        const WriteTable::Mod *w = this->writeTable.getMods(c);
+        for (int32_t i = 0; i < c->number; i++) {
+            ModSite *site = this->getModSiteByID(w[i].site);
+            if (!site) {
+                continue;
+            }
+            Mod *m = new Mod(site);
+            m->prio = w[i].prio;
+            m->repeat = w[i].repeat;
+            m->from_nlp = w[i].from_nlp != 0;
+            pmods->push_back(m);
+        }
+        return pmods;
+    }
+
+    const MOD_SITES *StaticAnalysisResult::GetRealModIrs(MOD_IR_TY *p_mod_irs) {
         if (!p_mod_irs) {
             return nullptr;
         }
-        MODS *mod_irs = new MODS();
+        std::lock_guard<std::mutex> guard(this->poolLock);
+        if (this->useModPool) {
+            auto cached = this->modInstLists.find(p_mod_irs);
+            if (cached != this->modInstLists.end()) {
+                return &cached->second;
+            }
+        }
+        MOD_SITES *mod_irs = this->useModPool ? &this->modInstLists[p_mod_irs] : new MOD_SITES();
         for (auto &el0 : *p_mod_irs) {
             const std::string &module = el0.first;
-            for (auto &el1 : (*p_mod_irs)[module]) {
+            for (auto &el1 : el0.second) {
                 const std::string &func = el1.first;
-                for (auto &el2 : (*p_mod_irs)[module][func]) {
+                for (auto &el2 : el1.second) {
                     const std::string &bb = el2.first;
-                    for (auto &el3 : (*p_mod_irs)[module][func][bb]) {
+                    for (auto &el3 : el2.second) {
                         const std::string &inst = el3.first;
                         //Get the actual Instruction* according to these string info
-                        llvm::Instruction *pinst = this->getInstFromStr(module, func, bb, inst);
+                        llvm::Instruction *pinst = nullptr;
+                        auto it = this->useLocationIndex ? this->modInstIndex.find(&el3.second)
+                                                         : this->modInstIndex.end();
+                        if (it != this->modInstIndex.end()) {
+                            pinst = it->second;
+                        } else {
+                            pinst = this->getInstFromStr(module, func, bb, inst);
+                        }
                         if (!pinst) {
                             continue;
                         }
-                        Mod *pmod = new Mod(pinst, &el3.second, this);
-                        mod_irs->push_back(pmod);
+                        mod_irs->push_back(this->getModSite(pinst, &el3.second));
                     }//inst
                 }//bb
             }//func
@@ -552,34 +788,39 @@ namespace sta {
         return mod_irs;
     }
 
-    MODS *StaticAnalysisResult::GetRealModBbs(MOD_IR_TY *p_mod_irs) {
+    const MOD_SITES *StaticAnalysisResult::GetRealModBbs(MOD_IR_TY *p_mod_irs) {
         if (!p_mod_irs) {
             return nullptr;
         }
-        MODS *mod_bbs = new MODS();
+        std::lock_guard<std::mutex> guard(this->poolLock);
+        if (this->useModPool) {
+            auto cached = this->modBBLists.find(p_mod_irs);
+            if (cached != this->modBBLists.end()) {
+                return &cached->second;
+            }
+        }
+        MOD_SITES *mod_bbs = this->useModPool ? &this->modBBLists[p_mod_irs] : new MOD_SITES();
         for (auto &el0 : *p_mod_irs) {
             const std::string &path = el0.first;
-            for (auto &el1 : (*p_mod_irs)[path]) {
+            for (auto &el1 : el0.second) {
                 const std::string &func = el1.first;
-                for (auto &el2 : (*p_mod_irs)[path][func]) {
+                for (auto &el2 : el1.second) {
                     const std::string &bb = el2.first;
-                    llvm::BasicBlock *pbb = this->getBBFromStr(path, func, bb);
+                    llvm::BasicBlock *pbb = nullptr;
+                    MOD_INF *p_mod_inf = nullptr;
+                    auto it = this->useLocationIndex ? this->modBBIndex.find(&el2.second) : this->modBBIndex.end();
+                    if (it != this->modBBIndex.end()) {
+                        pbb = it->second.first;
+                        p_mod_inf = it->second.second;
+                    } else {
+                        pbb = this->getBBFromStr(path, func, bb);
+                        p_mod_inf = this->getLastModInf(el2.second);
+                    }
                     if (!pbb) {
                         continue;
                     }
-                    //We should choose the last inst in the bb since it will overwrite the previous written value.
-                    //We can easily do this since we now use the inst's loop# within the parent BB to identify it.
-                    int k = -1;
-                    MOD_INF *p_mod_inf = nullptr;
-                    for (auto &el3 : (*p_mod_irs)[path][func][bb]) {
-                        if (k < 0 || std::stoi(el3.first) > k) {
-                            k = std::stoi(el3.first);
-                            p_mod_inf = &el3.second;
-                        }
-                    }
                     if (p_mod_inf) {
-                        Mod *pmod = new Mod(pbb, p_mod_inf, this);
-                        mod_bbs->push_back(pmod);
+                        mod_bbs->push_back(this->getModSite(&el2.second, pbb, p_mod_inf));
                     }
                 }//bb
             }//func
@@ -587,39 +828,94 @@ namespace sta {
         return mod_bbs;
     }
 
+    //We should choose the last inst in the bb since it will overwrite the previous written value.
+    //We can easily do this since we now use the inst's loop# within the parent BB to identify it.
+    MOD_INF *StaticAnalysisResult::getLastModInf(BB_MOD_TY &insts) {
+        int k = -1;
+        MOD_INF *p_mod_inf = nullptr;
+        for (auto &el3 : insts) {
+            int no = std::stoi(el3.first);
+            if (k < 0 || no > k) {
+                k = no;
+                p_mod_inf = &el3.second;
+            }
+        }
+        return p_mod_inf;
+    }
+
+    void StaticAnalysisResult::indexModIrs(MOD_IR_TY &mod_irs) {
+        for (auto &el0 : mod_irs) {
+            for (auto &el1 : el0.second) {
+                for (auto &el2 : el1.second) {
+                    if (this->modBBIndex.find(&el2.second) != this->modBBIndex.end()) {
+                        continue;
+                    }
+                    this->modBBID[&el2.second] = this->modBBOrder.size();
+                    this->modBBOrder.push_back(&el2.second);
+                    llvm::BasicBlock *pbb = this->getBBFromStr(el0.first, el1.first, el2.first);
+                    this->modBBIndex[&el2.second] = std::make_pair(pbb, this->getLastModInf(el2.second));
+                    for (auto &el3 : el2.second) {
+                        this->modInstIndex[&el3.second] = this->getInstFromStr(el0.first, el1.first, el2.first,
+                                                                               el3.first);
+                    }
+                }
+            }
+        }
+    }
+
+    void StaticAnalysisResult::buildLocationIndex() {
+        this->modInstIndex.clear();
+        this->modBBIndex.clear();
+        this->ctxIndex.clear();
+        this->modBBOrder.clear();
+        this->modBBID.clear();
+        for (auto &x : this->tagModMap) {
+            this->indexModIrs(x.second);
+        }
+        for (auto &x : this->calleeMap) {
+            this->indexModIrs(x.second);
+        }
+        for (auto &x : this->ctxMap) {
+            for (auto &loc : x.second) {
+                if (loc.size() < 4) {
+                    continue;
+                }
+                this->ctxIndex[&loc] = this->getInstFromStr(loc[3], loc[2], loc[1], loc[0]);
+            }
+        }
+    }
+
     llvm::Instruction *
-    StaticAnalysisResult::getInstFromStr(std::string path, std::string func, std::string bb, std::string inst) {
+    StaticAnalysisResult::getInstFromStr(const std::string &path, const std::string &func, const std::string &bb,
+                                         const std::string &inst) {
 
-        auto function = this->dm->Modules->Function;
+        auto &function = this->dm->Modules->Function;
         llvm::Instruction *iii = nullptr;
-        if (function.find(path) != function.end()) {
-            auto file = function[path];
-            if (file.find(func) != file.end()) {
-                auto f = file[func];
-                if (f->BasicBlock.find(bb) != f->BasicBlock.end()) {
-                    auto bbb = f->BasicBlock[bb]->basicBlock;
-                    for (llvm::Instruction &curInst : *bbb) {
-                        if (this->getInstStrID(&curInst) == inst) {
-                            iii = &curInst;
-                            return iii;
-                        }
-                    }//Inst
+        auto file = function.find(dra::DSymbol::lookup(path));
+        if (file != function.end()) {
+            auto ff = file->second.find(dra::DSymbol::lookup(func));
+            if (ff != file->second.end()) {
+                auto f = ff->second;
+                f->materialize();
+                auto db = f->get_DB_from_name(bb);
+                if (db != nullptr) {
+                    auto bbb = db->basicBlock;
+                    iii = this->getInstFromID(bbb, inst);
+                    if (iii) {
+                        return iii;
+                    }
                     std::cout << "not find inst : " << inst << " find bb : " << bb << std::endl;
                     // bbb->dump();
 
                 } else {
-                    for (auto &it : *f->function) {
-                        auto name = getBBStrID(&it);
-                        if (name == bb) {
-                            for (llvm::Instruction &curInst : it) {
-                                if (this->getInstStrID(&curInst) == inst) {
-                                    iii = &curInst;
-                                    return iii;
-                                }
-                            }
-                            std::cout << "not find inst : " << inst << std::endl;
-                            // it.dump();
+                    llvm::BasicBlock *it = this->getBBFromID(f->function, bb);
+                    if (it) {
+                        iii = this->getInstFromID(it, inst);
+                        if (iii) {
+                            return iii;
                         }
+                        std::cout << "not find inst : " << inst << std::endl;
+                        // it->dump();
                     }
                     std::cout << "not find bb : " << bb << std::endl;
                     // f->function->dump();
@@ -633,24 +929,28 @@ namespace sta {
         return iii;
     }
 
-    llvm::BasicBlock *StaticAnalysisResult::getBBFromStr(std::string path, std::string func, std::string bb) {
+    llvm::BasicBlock *
+    StaticAnalysisResult::getBBFromStr(const std::string &path, const std::string &func, const std::string &bb) {
 #if DEBUG_TIME
         std::time_t current_time = std::time(NULL);
         std::cout << std::ctime(&current_time) << "*time : getBBFromStr" << std::endl;
 #endif
 
         llvm::BasicBlock *bbb = nullptr;
-        auto function = this->dm->Modules->Function;
-        if (function.find(path) != function.end()) {
-            auto file = function[path];
-            if (file.find(func) != file.end()) {
+        auto &function = this->dm->Modules->Function;
+        auto file = function.find(dra::DSymbol::lookup(path));
+        if (file != function.end()) {
+            auto ff = file->second.find(dra::DSymbol::lookup(func));
+            if (ff != file->second.end()) {
 #if DEBUG_TIME
                 current_time = std::time(NULL);
                 std::cout << std::ctime(&current_time) << "*time : getBBFromStr function" << std::endl;
 #endif
-                auto f = file[func];
-                if (f->BasicBlock.find(bb) != f->BasicBlock.end()) {
-                    bbb = f->BasicBlock[bb]->basicBlock;
+                auto f = ff->second;
+                f->materialize();
+                auto db = f->get_DB_from_name(bb);
+                if (db != nullptr) {
+                    bbb = db->basicBlock;
 #if DEBUG_TIME
                     current_time = std::time(NULL);
                     std::cout << std::ctime(&current_time) << "*time : getBBFromStr basicBlock" << std::endl;
@@ -667,12 +967,9 @@ namespace sta {
                         std::cout << "path : " << path << std::endl;
                         std::cout << "func : " << func << std::endl;
                     } else {
-                        for (auto &it : *f->function) {
-                            auto name = getBBStrID(&it);
-                            if (name == bb) {
-                                bbb = &it;
-                                return bbb;
-                            }
+                        bbb = this->getBBFromID(f->function, bb);
+                        if (bbb) {
+                            return bbb;
                         }
                     }
 #if DEBUG_TIME
@@ -694,77 +991,68 @@ namespace sta {
         if (t0 == t1) {
             return true;
         }
-        if ((this->tagInfo.find(t0) == this->tagInfo.end()) != (this->tagInfo.find(t1) == this->tagInfo.end())) {
+        auto g0 = this->tagGroupIndex.find(t0);
+        auto g1 = this->tagGroupIndex.find(t1);
+        //Neither exists in the map, or only one of them.
+        if (g0 == this->tagGroupIndex.end() || g1 == this->tagGroupIndex.end()) {
             return false;
         }
-        if (this->tagInfo.find(t0) == this->tagInfo.end()) {
-            //Neither exists in the map.
-            return false;
+        return g0->second == g1->second;
+    }
+
+    std::string StaticAnalysisResult::getTagSignature(ID_TY tid) {
+        static const char *fields[] = {"v", "vid", "field", "is_global", "ty"};
+        std::string sig;
+        auto it = this->tagInfo.find(tid);
+        if (it == this->tagInfo.end()) {
+            return sig;
+        }
+        //A missing field is the same as an empty one.
+        for (auto f : fields) {
+            auto v = it->second.find(f);
+            if (v != it->second.end()) {
+                sig += v->second;
+            }
+            sig.push_back('\0');
         }
-        auto &inf0 = this->tagInfo[t0];
-        auto &inf1 = this->tagInfo[t1];
-        return inf0["v"] == inf1["v"] &&
-               inf0["vid"] == inf1["vid"] &&
-               inf0["field"] == inf1["field"] &&
-               inf0["is_global"] == inf1["is_global"] &&
-               inf0["ty"] == inf1["ty"];
+        return sig;
     }
 
-    //Group the same typed taint tags together.
+    //Group the same typed taint tags together, in one pass that hashes the signature of every tag.
     void StaticAnalysisResult::setupTagGroups() {
 #if DEBUG_TAG_GROUP
         std::cout << "-------TAG GROUP------\n";
 #endif
-        std::set<ID_TY> tags;
+        this->tagGroups.clear();
+        this->tagGroupIndex.clear();
+        this->tagGroupIndex.reserve(this->tagInfo.size());
+        std::unordered_map<std::string, uint32_t> groups;
         for (auto &x : this->tagInfo) {
-            tags.insert(x.first);
-        }
-        while (!tags.empty()) {
-            ID_TY tgt = *(tags.begin());
-            std::set<ID_TY> group;
-            std::set<ID_TY> temp;
-            for (auto it = tags.begin(); it != tags.end(); ++it) {
-                if (this->isSameTypedTag(tgt, *it)) {
-                    group.insert(*it);
-                } else {
-                    temp.insert(*it);
-                }
+            auto it = groups.insert(std::make_pair(this->getTagSignature(x.first), (uint32_t) this->tagGroups.size()));
+            if (it.second) {
+                this->tagGroups.emplace_back();
             }
-
-            tags.clear();
-            for (auto it : temp) {
-                tags.insert(it);
-            }
-            temp.clear();
-
-
-//            for (auto it = tags.begin(); it != tags.end(); ++it) {
-//                if (this->isSameTypedTag(tgt, *it)) {
-//                    group.insert(*it);
-//                    tags.erase(it);
-//                }
-//            }
+            this->tagGroups[it.first->second].insert(this->tagGroups[it.first->second].end(), x.first);
+            this->tagGroupIndex[x.first] = it.first->second;
+        }
 #if DEBUG_TAG_GROUP
+        for (auto &group : this->tagGroups) {
             std::cout << "+ ";
             for (auto &x : group) {
                 std::cout << (const void *) x << ", ";
             }
             std::cout << "\n";
-#endif
-            this->tagGroups.insert(group);
         }
-#if DEBUG_TAG_GROUP
         std::cout << "-------END------\n";
 #endif
     }
 
     const std::set<ID_TY> *StaticAnalysisResult::getSameTypedTags(ID_TY tid) {
-        for (auto &x : this->tagGroups) {
-            if (x.find(tid) != x.end()) {
-                return &x;
-            }
+        auto it = this->tagGroupIndex.find(tid);
+        if (it == this->tagGroupIndex.end()) {
+            return nullptr;
         }
-        return nullptr;
+        return &this->tagGroups[it->second];
     }
 
     /*
@@ -797,62 +1085,74 @@ namespace sta {
     }
     */
 
-    std::string &StaticAnalysisResult::getBBStrID(llvm::BasicBlock *B) {
-        static std::map<llvm::BasicBlock *, std::string> BBNameMap;
-        if (BBNameMap.find(B) == BBNameMap.end()) {
-            if (B) {
-                if (!B->getName().empty()) {
-                    BBNameMap[B] = B->getName().str();
-                } else if (B->getParent()) {
-                    int no = 0;
-                    for (llvm::BasicBlock &bb : *(B->getParent())) {
-                        if (&bb == B) {
-                            BBNameMap[B] = std::to_string(no);
-                            break;
-                        }
-                        ++no;
-                    }
-                } else {
-                    //Seems impossible..
-                    BBNameMap[B] = "";
-                }
-            } else {
-                BBNameMap[B] = "";
+    //The ordinals come from the numbering of the module, which walks a function once and keeps side arrays.
+    std::string StaticAnalysisResult::getBBStrID(llvm::BasicBlock *B) {
+        if (!B) {
+            return "";
+        }
+        if (!B->getName().empty()) {
+            return B->getName().str();
+        }
+        uint32_t no = this->dm->Modules->Numbering.getOrdinal(B);
+        if (no == dra::DNumbering::None) {
+            //Seems impossible..
+            return "";
+        }
+        return std::to_string(no);
+    }
+
+    std::string StaticAnalysisResult::getInstStrID(llvm::Instruction *I) {
+        uint32_t no = this->dm->Modules->Numbering.getOrdinal(I);
+        if (no == dra::DNumbering::None) {
+            //Seems impossible..
+            return "";
+        }
+        return std::to_string(no);
+    }
+
+    //The ordinal in a string id, or None if it is not the way std::to_string writes one.
+    static uint32_t parseOrdinal(const std::string &s) {
+        if (s.empty() || s.size() > 9 || (s[0] == '0' && s.size() > 1)) {
+            return dra::DNumbering::None;
+        }
+        uint32_t no = 0;
+        for (char c : s) {
+            if (c < '0' || c > '9') {
+                return dra::DNumbering::None;
             }
+            no = no * 10 + (c - '0');
         }
-        return BBNameMap[B];
+        return no;
     }
 
-    std::string &StaticAnalysisResult::getInstStrID(llvm::Instruction *I) {
-        static std::map<llvm::Instruction *, std::string> InstNameNoMap;
-        if (InstNameNoMap.find(I) == InstNameNoMap.end()) {
-            if (I) {
-                if (false) {
-                    //if (!I->getName().empty()){
-                    InstNameNoMap[I] = I->getName().str();
-                } else if (I->getParent()) {
-                    int no = 0;
-                    for (llvm::Instruction &i : *(I->getParent())) {
-                        if (&i == I) {
-                            InstNameNoMap[I] = std::to_string(no);
-                            break;
-                        }
-                        ++no;
-                    }
-                } else {
-                    //Seems impossible..
-                    InstNameNoMap[I] = "";
-                }
-            } else {
-                InstNameNoMap[I] = "";
+    llvm::BasicBlock *StaticAnalysisResult::getBBFromID(llvm::Function *F, const std::string &bb) {
+        if (!F) {
+            return nullptr;
+        }
+        uint32_t no = parseOrdinal(bb);
+        if (no != dra::DNumbering::None) {
+            llvm::BasicBlock *B = this->dm->Modules->Numbering.getBasicBlock(F, no);
+            if (B && B->getName().empty()) {
+                return B;
             }
         }
-        return InstNameNoMap[I];
+        //A named BB is identified by its name.
+        return this->dm->Modules->Numbering.getBasicBlock(F, llvm::StringRef(bb));
+    }
+
+    llvm::Instruction *StaticAnalysisResult::getInstFromID(llvm::BasicBlock *B, const std::string &inst) {
+        uint32_t no = parseOrdinal(inst);
+        if (!B || no == dra::DNumbering::None) {
+            return nullptr;
+        }
+        return this->dm->Modules->Numbering.getInstruction(B, no);
     }
 
     //Set up a cache for the expensive "print" operation.
     std::string &StaticAnalysisResult::getValueStr(llvm::Value *v) {
         static std::map<llvm::Value *, std::string> ValueNameMap;
+        static std::mutex ValueNameLock;
+        std::lock_guard<std::mutex> guard(ValueNameLock);
         if (ValueNameMap.find(v) == ValueNameMap.end()) {
             if (v) {
                 std::string str;
@@ -869,6 +1169,8 @@ namespace sta {
     //Set up a cache for the expensive "print" operation specifically for Type.
     std::string &StaticAnalysisResult::getTypeStr(llvm::Type *v) {
         static std::map<llvm::Type *, std::string> TypeNameMap;
+        static std::mutex TypeNameLock;
+        std::lock_guard<std::mutex> guard(TypeNameLock);
         if (TypeNameMap.find(v) == TypeNameMap.end()) {
             if (v) {
                 std::string str;
@@ -895,8 +1197,12 @@ namespace sta {
         }
         pctx->clear();
         for (auto &loc : this->ctxMap[id]) {
-            llvm::Instruction *inst = this->getInstFromStr(loc[3], loc[2], loc[1], loc[0]);
-            pctx->push_back(inst);
+            auto it = this->useLocationIndex ? this->ctxIndex.find(&loc) : this->ctxIndex.end();
+            if (it != this->ctxIndex.end()) {
+                pctx->push_back(it->second);
+            } else {
+                pctx->push_back(this->getInstFromStr(loc[3], loc[2], loc[1], loc[0]));
+            }
         }
         return true;
     }
@@ -971,6 +1277,126 @@ namespace sta {
         return matrix[n][m];
     }
 
+    int StaticAnalysisResult::levDistance(const std::string &source, const std::string &target, int bound) {
+        //The cells farther than bound from the diagonal are more than bound, so only the band of 2 * bound + 1 cells
+        //of the last three rows is kept, and every value above bound is cut to bound + 1.
+        const int MaxBound = 8;
+        if (bound < 0) {
+            return 0;
+        }
+        if (bound > MaxBound) {
+            return std::min(levDistance(source, target), bound + 1);
+        }
+        const int n = source.length();
+        const int m = target.length();
+        const int out = bound + 1;
+        if (std::abs(n - m) > bound) {
+            return out;
+        }
+        //rows[i % 3][j - i + bound] is matrix[i][j]
+        int rows[3][2 * MaxBound + 1];
+        const int width = 2 * bound + 1;
+        for (int d = 0; d < width; d++) {
+            int j = d - bound;
+            rows[0][d] = (j < 0 || j > m) ? out : std::min(j, out);
+        }
+        for (int i = 1; i <= n; i++) {
+            int *cur = rows[i % 3];
+            const int *up = rows[(i - 1) % 3];
+            const int *up2 = rows[(i - 2 + 3) % 3];
+            const char s_i = source[i - 1];
+            int best = out;
+            for (int d = 0; d < width; d++) {
+                int j = i + d - bound;
+                if (j < 0 || j > m) {
+                    cur[d] = out;
+                    continue;
+                }
+                if (j == 0) {
+                    cur[d] = std::min(i, out);
+                    best = std::min(best, cur[d]);
+                    continue;
+                }
+                const char t_j = target[j - 1];
+                const int above = d + 1 < width ? up[d + 1] : out;
+                const int left = d > 0 ? cur[d - 1] : out;
+                const int diag = up[d];
+                int cell = std::min(above + 1, std::min(left + 1, diag + (s_i == t_j ? 0 : 1)));
+                //The transposition as in levDistance.
+                if (i > 2 && j > 2) {
+                    int trans = up2[d] + 1;
+                    if (source[i - 2] != t_j) trans++;
+                    if (s_i != target[j - 2]) trans++;
+                    if (cell > trans) cell = trans;
+                }
+                cur[d] = std::min(cell, out);
+                best = std::min(best, cur[d]);
+            }
+            //No path can get back under the bound.
+            if (best == out) {
+                return out;
+            }
+        }
+        return rows[n % 3][m - n + bound];
+    }
+
+    void StaticAnalysisResult::countChars(const std::string &name, uint8_t *count) {
+        memset(count, 0, 32);
+        for (char c : name) {
+            uint8_t &n = count[c & 31];
+            if (n < UINT8_MAX) {
+                n++;
+            }
+        }
+    }
+
+    void StaticAnalysisResult::buildCalleeIndex() {
+        this->calleeIndex.clear();
+        for (auto &x : this->calleeMap) {
+            if (x.first.size() >= this->calleeIndex.size()) {
+                this->calleeIndex.resize(x.first.size() + 1);
+            }
+            this->calleeIndex[x.first.size()].emplace_back();
+            CalleeName &c = this->calleeIndex[x.first.size()].back();
+            c.callee = &x;
+            countChars(x.first, c.count);
+        }
+    }
+
+    void StaticAnalysisResult::getSimilarCallees(const std::string &name, int bound,
+                                                 std::vector<CALLEE_MAP_TY::value_type *> &res) {
+        res.clear();
+        if (bound < 0) {
+            return;
+        }
+        uint8_t count[32];
+        countChars(name, count);
+        uint64_t begin = name.size() > (uint64_t) bound ? name.size() - bound : 0;
+        uint64_t end = std::min((uint64_t) this->calleeIndex.size(), (uint64_t) name.size() + bound + 1);
+        for (uint64_t l = begin; l < end; l++) {
+            for (auto &c : this->calleeIndex[l]) {
+                //An edit changes the character counts by at most two and a transposition does not change them,
+                //so half of the difference of the counts is a lower bound of the distance.
+                int diff = 0;
+                for (int k = 0; k < 32; k++) {
+                    diff += std::abs((int) count[k] - (int) c.count[k]);
+                }
+                if (diff > 2 * bound) {
+                    continue;
+                }
+                int dis = levDistance(name, c.callee->first, bound);
+                if (dis == 0 || dis > bound) {
+                    continue;
+                }
+                res.push_back(c.callee);
+            }
+        }
+        //The buckets are by length, the callees are used in the order of the names as before.
+        std::sort(res.begin(), res.end(), [](const CALLEE_MAP_TY::value_type *a, const CALLEE_MAP_TY::value_type *b) {
+            return a->first < b->first;
+        });
+    }
+
     //the absolute return value is the #(arg taint tags), if the value is positive, then the "br" only has arg taints,
     //if negative, there also exists global variable taints.
     int StaticAnalysisResult::getArgTaintStatus(llvm::BasicBlock *B) {
@@ -15,10 +15,18 @@
 #include <llvm/IR/DebugInfo.h>
 #include <llvm/IR/CFG.h>
 #include <llvm/IR/Dominators.h>
+#include <llvm/ADT/BitVector.h>
+#include <llvm/ADT/DenseMap.h>
 #include <fstream>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 #include "../JSON/json.cpp"
 #include "ResType.h"
+#include "TaintFile.h"
+#include "WriteTable.h"
 #include "../DMM/DataManagement.h"
 #include "../DCC/general.h"
 #include <algorithm>
@@ -35,16 +43,21 @@ namespace sta {
     };
 
     class Mod;
+    class ModSite;
     class FieldPtr;
     typedef std::vector<Mod*> MODS;
+    //The resolved mods of the mod map of one tag or callee.
+    typedef std::vector<ModSite*> MOD_SITES;
 
     class StaticAnalysisResult {
     public:
-        StaticAnalysisResult(const std::string &staticRes, dra::DataManagement *DM) {
+        StaticAnalysisResult(const std::string &staticRes, dra::DataManagement *DM) : useLocationIndex(true),
+                                                                                       useModPool(true),
+                                                                                       hasWriteTable(false) {
             this->initStaticRes(staticRes, DM);
         }
 
-        StaticAnalysisResult() {
+        StaticAnalysisResult() : useLocationIndex(true), useModPool(true), hasWriteTable(false) {
             //
         }
 
@@ -52,13 +65,30 @@ namespace sta {
 
         int initStaticRes(const std::string &staticRes, dra::DataManagement *DM);
 
+        //The first half of initStaticRes, it only deserializes the tables into this object, so the results of
+        //several devices can be read in parallel. buildLocationIndex has to follow, one result at a time,
+        //since it materializes the functions of the module. The tables are decoded on up to thread threads
+        //(0 means all cores), 1 for a caller that is already parallel.
+        int readStaticRes(const std::string &staticRes, dra::DataManagement *DM, uint32_t thread = 0);
+
         LOC_INF *getLocInf(llvm::Instruction *, bool);
 
         LOC_INF *getLocInf(llvm::BasicBlock *);
 
-        llvm::Instruction *getInstFromStr(std::string path, std::string func, std::string bb, std::string inst);
+        llvm::Instruction *getInstFromStr(const std::string &path, const std::string &func, const std::string &bb,
+                                          const std::string &inst);
+
+        llvm::BasicBlock *getBBFromStr(const std::string &path, const std::string &func, const std::string &bb);
+
+        //Resolve the locations in the mod insts, callees and contexts once, so that the queries do not look up strings.
+        void buildLocationIndex();
 
-        llvm::BasicBlock *getBBFromStr(std::string path, std::string func, std::string bb);
+        //Whether the queries use the location index, otherwise they resolve the location strings on every call.
+        bool useLocationIndex;
+
+        //Whether the resolved mods are interned in the pool and the mods of every tag are cached,
+        //otherwise every query resolves the mod maps into new ModSites, which its Mods own and free.
+        bool useModPool;
 
         llvm::Module *p_module;
 
@@ -68,14 +98,37 @@ namespace sta {
 
         MODS *GetAllGlobalWriteBBs(llvm::BasicBlock *B, unsigned int branch);
 
+        //GetAllGlobalWriteBBs of every (BB, branch) on up to thread threads (0 means all cores), in the order of the queries.
+        //The queries are reentrant as long as useLocationIndex is on, otherwise they run on one thread.
+        std::vector<MODS *> GetAllGlobalWriteBBs(const std::vector<std::pair<llvm::BasicBlock *, unsigned int>> &queries,
+                                                 uint32_t thread = 0);
+
+        //Free the result of a query, the pooled ModSites in it are shared and stay in the pool.
+        static void releaseMods(MODS *pmods);
+
+        //The precomputed GetAllGlobalWriteBBs of the conditions, see WriteTable, key is checked against its header.
+        bool loadWriteTable(const std::string &path, const uint64_t key[2]);
+
+        //Write the results of GetAllGlobalWriteBBs(queries) with the trace_pc address of every query as a WriteTable.
+        bool writeWriteTable(const std::string &path, const uint64_t key[2], const std::vector<uint64_t> &addresses,
+                             const std::vector<std::pair<llvm::BasicBlock *, unsigned int>> &queries,
+                             const std::vector<MODS *> &res);
+
+        //The result of GetAllGlobalWriteBBs from the loaded table, found is false if the condition is not in it.
+        MODS *lookupWriteBBs(uint64_t address, unsigned int branch, bool *found);
+
+        bool hasWriteTable;
+
         //Whether a "br" in the given BB is tainted by the user provided "arg"?
         //the absolute return value is the #(arg taint tags), if the value is positive, then the "br" only has arg taints,
         //if negative, there also exists global variable taints.
         int getArgTaintStatus(llvm::BasicBlock *B);
 
-        std::string &getBBStrID(llvm::BasicBlock *B);
+        //The name of a named BB, otherwise its ordinal in the function.
+        std::string getBBStrID(llvm::BasicBlock *B);
 
-        std::string &getInstStrID(llvm::Instruction* I);
+        //The ordinal of the inst in its BB.
+        std::string getInstStrID(llvm::Instruction* I);
 
         std::string &getValueStr(llvm::Value *v);
 
@@ -90,11 +143,33 @@ namespace sta {
         //Calculate the Levenshtein distance between two strings as a measure of fuzzy matching.
         static int levDistance(const std::string& source, const std::string& target);
 
-        std::set<llvm::BasicBlock*> *get_all_successors(llvm::BasicBlock *bb);
+        //The same distance if it is at most bound, otherwise bound + 1, computed in a band of the matrix without allocation.
+        static int levDistance(const std::string& source, const std::string& target, int bound);
+
+        //The callees whose names are within the distance bound of name but not the same, in the order of calleeMap.
+        void getSimilarCallees(const std::string &name, int bound, std::vector<CALLEE_MAP_TY::value_type *> &res);
 
-        void _get_all_successors(llvm::BasicBlock *bb, std::set<llvm::BasicBlock*> &res);
+        //The BBs of one function by their position, and the BBs reachable from each of them (inclusive) as a bit vector,
+        //which is shared by the BBs of one strongly connected component.
+        struct BlockReach {
+            std::vector<llvm::BasicBlock *> Blocks;
+            llvm::DenseMap<const llvm::BasicBlock *, uint32_t> Ordinal;
+            //BB -> its strongly connected component
+            std::vector<uint32_t> Component;
+            //component -> the BBs reachable from it
+            std::vector<llvm::BitVector> Reach;
 
-        void getBranchSuccs(llvm::Instruction *inst, unsigned idx, std::set<llvm::BasicBlock*> &res);
+            //nullptr if the BB is not in this function
+            const llvm::BitVector *get_all_successors(const llvm::BasicBlock *bb) const;
+
+            bool contains(const llvm::BitVector &bits, const llvm::BasicBlock *bb) const;
+        };
+
+        //Built once per function on first use, from the condensation of its CFG.
+        const BlockReach *getBlockReach(llvm::Function *F);
+
+        //The BBs only reachable through the successor idx of inst, as bits of the returned BlockReach, nullptr if none.
+        const BlockReach *getBranchSuccs(llvm::Instruction *inst, unsigned idx, llvm::BitVector &res);
 
         llvm::DominatorTree *get_dom_tree(llvm::Function*);
 
@@ -107,9 +182,10 @@ namespace sta {
 
         std::vector<std::vector<FieldPtr*>*> *getTagType(ID_TY tag_id);
 
-    private:
-        nlohmann::json j_taintedBrs, j_ctxMap, j_traitMap, j_tagModMap, j_tagConstMap, j_tagInfo, j_calleeMap;
+        //All the tags with the same type as tid, including tid, one lookup.
+        const std::set<ID_TY> *getSameTypedTags(ID_TY tid);
 
+    private:
         TAINTED_BR_TY taintedBrs;
         CTX_MAP_TY ctxMap;
         INST_TRAIT_MAP traitMap;
@@ -120,19 +196,83 @@ namespace sta {
         TAG_INFO_TY tagInfo_local;
         CALLEE_MAP_TY calleeMap;
 
-        std::set<std::set<ID_TY>> tagGroups;
+        //The same typed tags, a tag is in exactly one group.
+        std::vector<std::set<ID_TY>> tagGroups;
+        //tag -> its group in tagGroups
+        std::unordered_map<ID_TY, uint32_t> tagGroupIndex;
 
-        //The mapping from one BB to all its successors (recursively).
-        std::map<llvm::BasicBlock*,std::set<llvm::BasicBlock*>> succ_map;
+        //The mapping from one Func to the reachability of its BBs.
+        std::unordered_map<const llvm::Function*,std::unique_ptr<BlockReach>> reach_map;
+        std::mutex reachLock;
 
-        //The mapping from one Func to its dominator tree;
+        //The mapping from one Func to its dominator tree, DFS numbered before it is published;
         std::map<llvm::Function*,llvm::DominatorTree*> dom_map;
+        std::mutex domLock;
+
+        //inst -> MOD_INF of the mod insts in one BB of a MOD_IR_TY
+        typedef std::map<std::string, MOD_INF> BB_MOD_TY;
+
+        //The location index, keyed by the entries of the tables above, which are never changed after the load.
+        //MOD_INF of a mod inst -> its inst
+        std::unordered_map<const MOD_INF *, llvm::Instruction *> modInstIndex;
+        //mod insts of one BB -> the BB and the MOD_INF of its last mod inst
+        std::unordered_map<const BB_MOD_TY *, std::pair<llvm::BasicBlock *, MOD_INF *>> modBBIndex;
+        //one frame of a context -> its inst
+        std::unordered_map<const LOC_INF *, llvm::Instruction *> ctxIndex;
+
+        void indexModIrs(MOD_IR_TY &mod_irs);
+
+        //The mod BBs in the order of the loaded tables, the position is the id of their ModSite in a WriteTable.
+        std::vector<const BB_MOD_TY *> modBBOrder;
+        std::unordered_map<const BB_MOD_TY *, uint32_t> modBBID;
+
+        WriteTable writeTable;
+
+        //The pool of the resolved mods, keyed like the location index, a ModSite is never freed.
+        std::unordered_map<const MOD_INF *, ModSite *> modInstPool;
+        std::unordered_map<const BB_MOD_TY *, ModSite *> modBBPool;
+        //mod map of a tag or a callee -> its resolved mods, in the order of the map
+        std::unordered_map<const MOD_IR_TY *, MOD_SITES> modInstLists;
+        std::unordered_map<const MOD_IR_TY *, MOD_SITES> modBBLists;
+        //Guards the pool and the lists, a list is never changed once it is returned.
+        std::mutex poolLock;
+
+        ModSite *getModSite(llvm::Instruction *I, const MOD_INF *p_mod_inf);
+
+        ModSite *getModSite(const BB_MOD_TY *insts, llvm::BasicBlock *B, const MOD_INF *p_mod_inf);
+
+        //The mod BB of an id of modBBOrder, nullptr if it can not be resolved.
+        ModSite *getModSiteByID(uint32_t id);
+
+        //The mods of all the global tags (and their same typed tags) of the contexts of a branch, without duplicates.
+        MODS *collectMods(BR_INF *p_taint_inf, bool bbs, ID_TY *trait_id);
+
+        struct CalleeName {
+            CALLEE_MAP_TY::value_type *callee;
+            //The number of every character in the name, by its low five bits.
+            uint8_t count[32];
+        };
+
+        //The entries of calleeMap by the length of the callee name, only the lengths near a query are compared.
+        std::vector<std::vector<CalleeName>> calleeIndex;
+
+        static void countChars(const std::string &name, uint8_t *count);
+
+        void buildCalleeIndex();
+
+        //The inverse of getBBStrID and getInstStrID.
+        llvm::BasicBlock *getBBFromID(llvm::Function *F, const std::string &bb);
+
+        llvm::Instruction *getInstFromID(llvm::BasicBlock *B, const std::string &inst);
+
+        MOD_INF *getLastModInf(BB_MOD_TY &insts);
 
         BR_INF *QueryBranchTaint(llvm::BasicBlock *B);
 
-        MODS *GetRealModIrs(MOD_IR_TY *p_mod_irs);
+        //The lists are owned by the pool, unless useModPool is off.
+        const MOD_SITES *GetRealModIrs(MOD_IR_TY *p_mod_irs);
 
-        MODS *GetRealModBbs(MOD_IR_TY *p_mod_irs);
+        const MOD_SITES *GetRealModBbs(MOD_IR_TY *p_mod_irs);
 
         void tweakModsOnTraits(MODS *pmods, ID_TY br_trait_id, unsigned int branch);
 
@@ -142,103 +282,80 @@ namespace sta {
 
         std::vector<FieldPtr*> *parseTypeStr(std::string tys);
 
-        const std::set<ID_TY> *getSameTypedTags(ID_TY tid);
-
         bool isSameTypedTag(ID_TY t0, ID_TY t1);
 
+        //The fields of a tag which decide its type, the tags with the same signature are in the same group.
+        std::string getTagSignature(ID_TY tid);
+
         void setupTagGroups();
     };
 
-    //A BB/Inst that can modify a global state.
-    class Mod {
+    //A BB/Inst that can modify a global state, resolved once from one entry of the mod maps.
+    //It is interned in the pool of StaticAnalysisResult and shared by the Mods of all the queries,
+    //so the properties computed on first use are computed once even if the queries run concurrently.
+    //Without the pool it belongs to the one Mod made from it.
+    class ModSite {
     public:
-        Mod() {}
-
-        Mod(llvm::BasicBlock *b, MOD_INF *pm, StaticAnalysisResult *sta) {
+        ModSite(llvm::BasicBlock *b, const MOD_INF *pm, StaticAnalysisResult *sta) {
             this->init_properties();
             this->B = b;
             this->I = nullptr;
-            this->mod_inf = *pm;
-            this->pallcmds = nullptr;
+            this->mod_inf = pm;
             this->sta = sta;
+            this->single_trait = this->getSingleTraitFromInf();
         }
 
-        Mod(llvm::Instruction *i, MOD_INF *pm, StaticAnalysisResult *sta) {
+        ModSite(llvm::Instruction *i, const MOD_INF *pm, StaticAnalysisResult *sta) {
             this->init_properties();
             this->I = i;
             this->B = nullptr;
             if (i) {
                 this->B = i->getParent();
             }
-            this->mod_inf = *pm;
-            this->pallcmds = nullptr;
+            this->mod_inf = pm;
             this->sta = sta;
+            this->single_trait = this->getSingleTraitFromInf();
         }
 
-        ~Mod() {
-            //
-        }
-
-        bool equal(const Mod *m) {
-            if (!m) {
-                return false;
+        ~ModSite() {
+            delete this->pallcmds;
+            for (auto *c : this->all_cmd_ctx) {
+                delete c;
             }
-            return (this->B == m->B && this->I == m->I);
         }
 
-        int calcPrio(std::string& cond, int64_t v) {
-            int p = 0;
-            TRAIT *pt = this->getSingleTrait();
-            if ((!pt) || pt->empty()) {
-                p = 0;
-            }else if (this->from_nlp) {
-                //TODO: What priority should we set for the mod IR from callee name NLP analysis?
-                p = 0;
-            }else if (cond == "==") {
-                p = calcPrio_E(v);
-            }else if (cond == "!=") {
-                p = calcPrio_NE(v);
-            }else if (cond == ">=" || cond == ">") {
-                p = calcPrio_B(v, cond == ">=");
-            }else if (cond == "<=" || cond == "<") {
-                p = calcPrio_S(v, cond == "<=");
-            }else if (cond == "") {
-                p = calcPrio_UNK();
+        llvm::BasicBlock *B;
+        llvm::Instruction *I;
+        //The position of a mod BB in the loaded tables, NO_ID for a mod inst.
+        uint32_t id;
+        static const uint32_t NO_ID = 0xffffffff;
+        //Whether the site is shared through the pool, otherwise the Mod made from it owns it.
+        bool pooled;
+
+        //The key of the duplicate check of the mods, the inst of a mod inst or the BB of a mod BB.
+        const llvm::Value *key() const {
+            if (this->I) {
+                return this->I;
             }
-            this->prio = p;
-            return p;
+            return this->B;
         }
-        
+
         std::set<uint64_t> *getIoctlCmdSet() {
-            if (this->pallcmds) {
-                return this->pallcmds;
-            }
-            if (this->mod_inf.empty()) {
+            if (this->mod_inf->empty()) {
                 return nullptr;
             }
-            this->pallcmds = new std::set<uint64_t>();
-            for (auto &x : this->mod_inf) {
-                std::set<uint64_t> &cs = x.second[1];
-                this->pallcmds->insert(cs.begin(), cs.end());
-            }
+            std::call_once(this->pallcmds_once, [this]() {
+                this->pallcmds = new std::set<uint64_t>();
+                for (auto &x : *this->mod_inf) {
+                    auto cs = x.second.find(1);
+                    if (cs != x.second.end()) {
+                        this->pallcmds->insert(cs->second.begin(), cs->second.end());
+                    }
+                }
+            });
             return this->pallcmds;
         }
 
-        void init_properties() {
-            this->sta = nullptr;
-            this->repeat = 1;
-            this->prio = 0;
-            this->from_nlp = false;
-            this->single_trait_id = 0;
-        }
-
-        llvm::BasicBlock *B;
-        llvm::Instruction *I;
-        //0: repeat but not sure about the times, >0: repeat at least for a certain time ("1" means no repeat).
-        int64_t repeat;
-        int prio;
-        bool from_nlp;
-
         bool is_trait_fixed() {
             TRAIT *tr = this->getSingleTrait();
             if (!tr) {
@@ -251,21 +368,20 @@ namespace sta {
         std::vector<std::vector<llvm::Instruction*>> ctxs;
 
         std::vector<std::vector<llvm::Instruction*>> *get_ctxs() {
-            if (!this->ctxs.empty()) {
-                return &(this->ctxs);
-            }
-            if (this->mod_inf.empty() || !this->sta) {
+            if (this->mod_inf->empty() || !this->sta) {
                 return nullptr;
             }
-            for (auto& x : this->mod_inf) {
-                std::vector<llvm::Instruction*> vec;
-                if(this->sta->getCtx(x.first,&vec)){
+            std::call_once(this->ctxs_once, [this]() {
+                for (auto& x : *this->mod_inf) {
+                    std::vector<llvm::Instruction*> vec;
+                    if(this->sta->getCtx(x.first,&vec)){
 
-                } else {
+                    } else {
 
+                    }
+                    this->ctxs.push_back(vec);
                 }
-                this->ctxs.push_back(vec);
-            }
+            });
             return &(this->ctxs);
         }
 
@@ -274,11 +390,11 @@ namespace sta {
         //hz: TODO: the implementation is memory-consuming since it needs to repeatedly copy contexts for each cmd,
         //we can store only the ctx pointer and group the cmds associating with a same ctx.
         std::vector<cmd_ctx *> *get_cmd_ctx() {
-            if (all_cmd_ctx.empty()) {
+            std::call_once(this->all_cmd_ctx_once, [this]() {
 #if DEBUG
                 dra::outputTime("get_cmd_ctx : start");
 #endif
-                for (auto &x : this->mod_inf) {
+                for (auto &x : *this->mod_inf) {
                     cmd_ctx *temp = new cmd_ctx();
                     if (this->sta->getCtx(x.first, &(temp->ctx))) {
 #if DEBUG
@@ -289,9 +405,11 @@ namespace sta {
                         dra::outputTime("getCtx : false");
 #endif
                     }
-                    std::set<uint64_t> &cs = x.second[1];
-                    for(auto c : cs){
-                        temp->cmd.push_back(c);
+                    auto cs = x.second.find(1);
+                    if (cs != x.second.end()) {
+                        for (auto c : cs->second) {
+                            temp->cmd.push_back(c);
+                        }
                     }
                     this->all_cmd_ctx.push_back(temp);
                 }
@@ -303,61 +421,133 @@ namespace sta {
                     this->sta->dm->dump_ctxs(&c->ctx);
                 }
 #endif
-            }
+            });
             return &all_cmd_ctx;
         }
 
+        TRAIT *getSingleTrait() {
+            return this->single_trait;
+        }
+
     private:
+        friend class Mod;
+
         StaticAnalysisResult *sta;
-        MOD_INF mod_inf;
+        //The entry in the loaded tables, which is never changed after the load.
+        const MOD_INF *mod_inf;
         std::set<uint64_t> *pallcmds;
-        uint64_t single_trait_id;
-        TRAIT single_trait;
+        std::once_flag pallcmds_once;
+        std::once_flag ctxs_once;
+        std::once_flag all_cmd_ctx_once;
+        //The trait in the trait map of the loaded tables, nullptr if there is none.
+        TRAIT *single_trait;
+
+        void init_properties() {
+            this->id = NO_ID;
+            this->pooled = true;
+            this->sta = nullptr;
+            this->mod_inf = nullptr;
+            this->pallcmds = nullptr;
+            this->single_trait = nullptr;
+        }
 
         //TODO: now we assume all traits are the same even under differnt contexts.
-        //So only return one trait id.
-        ID_TY getSingleTraitID() {
-            if (this->single_trait_id) {
-                return this->single_trait_id;
-            }
-            if (this->mod_inf.empty()) {
-                return 0;
+        //So only take one trait id.
+        TRAIT *getSingleTraitFromInf() {
+            if (!this->sta) {
+                return nullptr;
             }
-            for (auto& x : this->mod_inf) {
-                if (x.second.find(TRAIT_INDEX) == x.second.end()) {
-                    continue;
-                }
-                std::set<uint64_t> &tids = x.second[TRAIT_INDEX];
-                if (tids.empty()) {
+            for (auto& x : *this->mod_inf) {
+                auto tids = x.second.find(TRAIT_INDEX);
+                if (tids == x.second.end() || tids->second.empty()) {
                     continue;
                 }
-                for (auto& y : tids) {
-                    this->single_trait_id = y;
-                    return y;
+                ID_TY stid = *tids->second.begin();
+                if (!stid) {
+                    return nullptr;
                 }
+                return this->sta->getTrait(stid);
             }
-            return 0;
+            return nullptr;
         }
+    };
 
-        TRAIT *getSingleTrait() {
-            if (!this->single_trait.empty()) {
-                return &(this->single_trait);
+    //A mod returned by a query: the shared ModSite and its ranking for the queried branch.
+    class Mod {
+    public:
+        explicit Mod(ModSite *site) {
+            this->site = site;
+            this->B = site->B;
+            this->I = site->I;
+            this->repeat = 1;
+            this->prio = 0;
+            this->from_nlp = false;
+        }
+
+        ~Mod() {
+            if (!this->site->pooled) {
+                delete this->site;
             }
-            ID_TY stid = this->getSingleTraitID();
-            if ((!this->sta) || (!stid)) {
-                return nullptr;
+        }
+
+        bool equal(const Mod *m) {
+            if (!m) {
+                return false;
             }
-            TRAIT *pt = this->sta->getTrait(stid);
-            if (pt) {
-                this->single_trait = *pt;
-                return &(this->single_trait);
+            return (this->B == m->B && this->I == m->I);
+        }
+
+        int calcPrio(std::string& cond, int64_t v) {
+            int p = 0;
+            TRAIT *pt = this->site->getSingleTrait();
+            if ((!pt) || pt->empty()) {
+                p = 0;
+            }else if (this->from_nlp) {
+                //TODO: What priority should we set for the mod IR from callee name NLP analysis?
+                p = 0;
+            }else if (cond == "==") {
+                p = calcPrio_E(v);
+            }else if (cond == "!=") {
+                p = calcPrio_NE(v);
+            }else if (cond == ">=" || cond == ">") {
+                p = calcPrio_B(v, cond == ">=");
+            }else if (cond == "<=" || cond == "<") {
+                p = calcPrio_S(v, cond == "<=");
+            }else if (cond == "") {
+                p = calcPrio_UNK();
             }
-            return pt;
+            this->prio = p;
+            return p;
         }
+        
+        std::set<uint64_t> *getIoctlCmdSet() {
+            return this->site->getIoctlCmdSet();
+        }
+
+        ModSite *site;
+        llvm::BasicBlock *B;
+        llvm::Instruction *I;
+        //0: repeat but not sure about the times, >0: repeat at least for a certain time ("1" means no repeat).
+        int64_t repeat;
+        int prio;
+        bool from_nlp;
 
+        bool is_trait_fixed() {
+            return this->site->is_trait_fixed();
+        }
+
+        std::vector<std::vector<llvm::Instruction*>> *get_ctxs() {
+            return this->site->get_ctxs();
+        }
+
+        std::vector<cmd_ctx *> *get_cmd_ctx() {
+            return this->site->get_cmd_ctx();
+        }
+
+    private:
         int calcPrio_E(int64_t n) {
             int p = 0;
-            for (auto& x : this->single_trait) {
+            for (auto& x : *this->site->single_trait) {
                 std::string s = x.first;
                 int64_t v = x.second;
                 if (s == "CONST_INT" || s == "CONST_NULLPTR") {
@@ -382,7 +572,7 @@ namespace sta {
 
         int calcPrio_NE(int64_t n) {
             int p = 0;
-            for (auto& x : this->single_trait) {
+            for (auto& x : *this->site->single_trait) {
                 std::string s = x.first;
                 int64_t v = x.second;
                 if (s == "CONST_INT" || s == "CONST_NULLPTR") {
@@ -412,7 +602,7 @@ namespace sta {
 
         int calcPrio_B(int64_t n, bool inclusive) {
             int p = 0;
-            for (auto& x : this->single_trait) {
+            for (auto& x : *this->site->single_trait) {
                 std::string s = x.first;
                 int64_t v = x.second;
                 if (s == "CONST_INT") {
@@ -450,7 +640,7 @@ namespace sta {
 
         int calcPrio_S(int64_t n, bool inclusive) {
             int p = 0;
-            for (auto& x : this->single_trait) {
+            for (auto& x : *this->site->single_trait) {
                 std::string s = x.first;
                 int64_t v = x.second;
                 if (s == "CONST_INT") {
@@ -492,7 +682,7 @@ namespace sta {
         //TODO:
         int calcPrio_UNK() {
             int p = 0;
-            for (auto& x : this->single_trait) {
+            for (auto& x : *this->site->single_trait) {
                 std::string s = x.first;
                 int64_t v = x.second;
                 if (s == "CONST_NULLPTR") {
@@ -0,0 +1,370 @@
+/*
+ * TaintFile.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "TaintFile.h"
+
+#include <llvm/ADT/StringMap.h>
+#include <llvm/ADT/StringRef.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+#include "TaintSax.h"
+#include "../DCC/general.h"
+
+namespace sta {
+
+    const uint64_t TaintFile::Magic = 0x544e494154415230; // "0RATAINT"
+    const uint32_t TaintFile::Version = 1;
+
+    namespace {
+        class TaintWriter {
+        public:
+            void put32(uint32_t v) {
+                body.append(reinterpret_cast<const char *>(&v), sizeof(v));
+            }
+
+            void put64(uint64_t v) {
+                body.append(reinterpret_cast<const char *>(&v), sizeof(v));
+            }
+
+            template<class T>
+            typename std::enable_if<std::is_integral<T>::value>::type put(const T &v) {
+                put64(static_cast<uint64_t>(v));
+            }
+
+            void put(const std::string &s) {
+                auto it = ids.insert(std::make_pair(s, (uint32_t) strings.size()));
+                if (it.second) {
+                    strings.push_back(it.first->getKey());
+                }
+                put32(it.first->getValue());
+            }
+
+            template<class K, class V>
+            void put(const std::map<K, V> &m) {
+                put32(m.size());
+                for (const auto &it : m) {
+                    put(it.first);
+                    put(it.second);
+                }
+            }
+
+            template<class T>
+            void put(const std::set<T> &s) {
+                put32(s.size());
+                for (const auto &it : s) {
+                    put(it);
+                }
+            }
+
+            template<class T>
+            void put(const std::vector<T> &v) {
+                put32(v.size());
+                for (const auto &it : v) {
+                    put(it);
+                }
+            }
+
+            template<class A, class B>
+            void put(const std::tuple<A, B> &t) {
+                put(std::get<0>(t));
+                put(std::get<1>(t));
+            }
+
+        public:
+            std::string body;
+            llvm::StringMap<uint32_t> ids;
+            std::vector<llvm::StringRef> strings;
+        };
+
+        // the elements are written in the order of the std containers, so they are appended with end() as hint
+        class TaintReader {
+        public:
+            TaintReader(llvm::StringRef buffer, const std::vector<llvm::StringRef> &strings)
+                    : p(buffer.begin()), end(buffer.end()), fail(false), strings(strings) {}
+
+            uint32_t get32() {
+                uint32_t v = 0;
+                get(&v, sizeof(v));
+                return v;
+            }
+
+            uint64_t get64() {
+                uint64_t v = 0;
+                get(&v, sizeof(v));
+                return v;
+            }
+
+            template<class T>
+            typename std::enable_if<std::is_integral<T>::value>::type get(T &v) {
+                v = static_cast<T>(get64());
+            }
+
+            void get(std::string &s) {
+                uint32_t id = get32();
+                if (id >= strings.size()) {
+                    fail = true;
+                    return;
+                }
+                s.assign(strings[id].data(), strings[id].size());
+            }
+
+            template<class K, class V>
+            void get(std::map<K, V> &m) {
+                uint32_t size = get32();
+                for (uint32_t i = 0; i < size && !fail; i++) {
+                    K k;
+                    get(k);
+                    auto it = m.emplace_hint(m.end(), std::move(k), V());
+                    get(it->second);
+                }
+            }
+
+            template<class T>
+            void get(std::set<T> &s) {
+                uint32_t size = get32();
+                for (uint32_t i = 0; i < size && !fail; i++) {
+                    T t;
+                    get(t);
+                    s.emplace_hint(s.end(), std::move(t));
+                }
+            }
+
+            template<class T>
+            void get(std::vector<T> &v) {
+                uint32_t size = get32();
+                // every element takes at least four bytes
+                if (size > (uint64_t) (end - p) / sizeof(uint32_t)) {
+                    fail = true;
+                    return;
+                }
+                v.resize(size);
+                for (uint32_t i = 0; i < size && !fail; i++) {
+                    get(v[i]);
+                }
+            }
+
+            template<class A, class B>
+            void get(std::tuple<A, B> &t) {
+                get(std::get<0>(t));
+                get(std::get<1>(t));
+            }
+
+        private:
+            void get(void *v, size_t size) {
+                if ((size_t) (end - p) < size) {
+                    fail = true;
+                    return;
+                }
+                memcpy(v, p, size);
+                p += size;
+            }
+
+        public:
+            const char *p;
+            const char *end;
+            bool fail;
+            const std::vector<llvm::StringRef> &strings;
+        };
+
+        // apply f to the seven tables of info in the order of the file
+        template<class INFO, class F>
+        void forEachTable(INFO &info, uint32_t i, F &&f) {
+            switch (i) {
+                case 0: {
+                    f(info.taintedBrs);
+                    break;
+                }
+                case 1: {
+                    f(info.ctxMap);
+                    break;
+                }
+                case 2: {
+                    f(info.traitMap);
+                    break;
+                }
+                case 3: {
+                    f(info.tagModMap);
+                    break;
+                }
+                case 4: {
+                    f(info.tagConstMap);
+                    break;
+                }
+                case 5: {
+                    f(info.tagInfo);
+                    break;
+                }
+                case 6: {
+                    f(info.calleeMap);
+                    break;
+                }
+                default: {
+                }
+            }
+        }
+
+        struct TableWriter {
+            TaintWriter &w;
+
+            template<class T>
+            void operator()(const T &table) {
+                w.put(table);
+            }
+        };
+
+        struct TableReader {
+            TaintReader &r;
+
+            template<class T>
+            void operator()(T &table) {
+                table = T();
+                r.get(table);
+            }
+        };
+    } /* namespace */
+
+    bool TaintFile::isBinary(const std::string &path) {
+        std::ifstream input(path, std::ios::in | std::ios::binary);
+        uint64_t magic = 0;
+        input.read(reinterpret_cast<char *>(&magic), sizeof(magic));
+        return input && magic == Magic;
+    }
+
+    bool TaintFile::read(const std::string &path, TAINT_INFO &info, uint32_t thread) {
+        if (isBinary(path)) {
+            return readBinary(path, info, thread);
+        }
+        return readJson(path, info);
+    }
+
+    bool TaintFile::readJson(const std::string &path, TAINT_INFO &info) {
+        std::ifstream infile(path);
+        if (!infile.is_open()) {
+            std::cerr << "Unable to open taint_info file " << path << std::endl;
+            return false;
+        }
+        return readTaint(infile, info.taintedBrs) && readTaint(infile, info.ctxMap) &&
+               readTaint(infile, info.traitMap) && readTaint(infile, info.tagModMap) &&
+               readTaint(infile, info.tagConstMap) && readTaint(infile, info.tagInfo) &&
+               readTaint(infile, info.calleeMap);
+    }
+
+    bool TaintFile::writeBinary(const std::string &path, const TAINT_INFO &info) {
+        TaintWriter w;
+        uint64_t table[NumberTable + 1];
+        for (uint32_t i = 0; i < NumberTable; i++) {
+            table[i] = w.body.size();
+            forEachTable(info, i, TableWriter{w});
+        }
+        table[NumberTable] = w.body.size();
+
+        TaintWriter header;
+        header.put64(Magic);
+        header.put32(Version);
+        header.put32(w.strings.size());
+        uint64_t strings = 0;
+        for (auto s : w.strings) {
+            strings += sizeof(uint32_t) + s.size();
+        }
+        // header, offset and size of every table, size of the file
+        uint64_t begin = header.body.size() + (2 * NumberTable + 1) * sizeof(uint64_t) + strings;
+        for (uint32_t i = 0; i < NumberTable; i++) {
+            header.put64(begin + table[i]);
+            header.put64(table[i + 1] - table[i]);
+        }
+        header.put64(begin + w.body.size());
+        for (auto s : w.strings) {
+            header.put32(s.size());
+            header.body.append(s.data(), s.size());
+        }
+
+        std::string temp = path + ".tmp";
+        std::ofstream output(temp, std::ios::out | std::ios::trunc | std::ios::binary);
+        output.write(header.body.data(), header.body.size());
+        output.write(w.body.data(), w.body.size());
+        output.close();
+        if (!output || std::rename(temp.c_str(), path.c_str()) != 0) {
+            std::cerr << "Failed to write taint_info file " << path << std::endl;
+            std::remove(temp.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool TaintFile::readBinary(const std::string &path, TAINT_INFO &info, uint32_t thread) {
+        auto buffer = dra::mapFile(path);
+        if (!buffer) {
+            std::cerr << "Unable to open taint_info file " << path << std::endl;
+            return false;
+        }
+        llvm::StringRef file = (*buffer)->getBuffer();
+        std::vector<llvm::StringRef> strings;
+        TaintReader r(file, strings);
+        if (r.get64() != Magic) {
+            std::cerr << "not a compiled taint_info file " << path << std::endl;
+            return false;
+        }
+        uint32_t version = r.get32();
+        if (version != Version) {
+            std::cerr << "taint_info file " << path << " has version " << version << ", compile it again with t2b"
+                      << std::endl;
+            return false;
+        }
+        uint32_t number_string = r.get32();
+        uint64_t table[NumberTable][2];
+        for (auto &t : table) {
+            t[0] = r.get64();
+            t[1] = r.get64();
+            if (t[0] > file.size() || t[1] > file.size() - t[0]) {
+                r.fail = true;
+            }
+        }
+        // a file cut by a crash is never used
+        if (r.get64() != file.size() || r.fail) {
+            std::cerr << "broken taint_info file " << path << std::endl;
+            return false;
+        }
+        // the strings point into the mapped file, each one takes at least its 4 byte size, so a broken count
+        // cannot make the reserve bigger than the file
+        strings.reserve(std::min<uint64_t>(number_string, (uint64_t) (r.end - r.p) / 4));
+        for (uint32_t i = 0; i < number_string && !r.fail; i++) {
+            uint32_t size = r.get32();
+            if ((uint64_t) (r.end - r.p) < size) {
+                r.fail = true;
+                break;
+            }
+            strings.emplace_back(r.p, size);
+            r.p += size;
+        }
+        if (r.fail) {
+            std::cerr << "broken taint_info file " << path << std::endl;
+            return false;
+        }
+
+        // the tables are independent, they are decoded in parallel
+        bool fail[NumberTable] = {};
+        dra::parallel_for(NumberTable, thread == 0 ? dra::number_thread() : thread, [&](uint64_t i) {
+            TaintReader tr(file.substr(table[i][0], table[i][1]), strings);
+            forEachTable(info, i, TableReader{tr});
+            fail[i] = tr.fail || tr.p != tr.end;
+        });
+        for (auto f : fail) {
+            if (f) {
+                std::cerr << "broken taint_info file " << path << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+
+} /* namespace sta */
@@ -0,0 +1,48 @@
+/*
+ * TaintFile.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef LIB_STA_TAINTFILE_H_
+#define LIB_STA_TAINTFILE_H_
+
+#include <cstdint>
+#include <string>
+#include "ResType.h"
+
+namespace sta {
+
+    // Loader of the taint_info files of the static analysis, either the json form written by the analysis
+    // or the compiled binary form written by t2b.
+    //
+    // binary layout, little endian:
+    //   header: magic, version, number of strings, size of the string bytes, offset and size of the seven tables
+    //   string table: (offset, length) of every string, then the bytes
+    //   the seven tables of TAINT_INFO, every table is a flat array of 32 and 64 bit words:
+    //     a map, set or vector is its size followed by its elements in order,
+    //     a map element is its key followed by its value, a tuple is its elements,
+    //     a string is its id in the string table and an integer is 64 bits.
+    class TaintFile {
+    public:
+        // the json form or the binary form, by the magic at the beginning of the file,
+        // the binary tables are decoded on up to thread threads (0 means all cores)
+        static bool read(const std::string &path, TAINT_INFO &info, uint32_t thread = 0);
+
+        static bool readJson(const std::string &path, TAINT_INFO &info);
+
+        static bool readBinary(const std::string &path, TAINT_INFO &info, uint32_t thread = 0);
+
+        static bool writeBinary(const std::string &path, const TAINT_INFO &info);
+
+        static bool isBinary(const std::string &path);
+
+    public:
+        static const uint64_t Magic;
+        static const uint32_t Version;
+        static const uint32_t NumberTable = 7;
+    };
+
+} /* namespace sta */
+
+#endif /* LIB_STA_TAINTFILE_H_ */
@@ -0,0 +1,348 @@
+/*
+ * TaintSax.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef LIB_STA_TAINTSAX_H_
+#define LIB_STA_TAINTSAX_H_
+
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include "../JSON/json.cpp"
+
+namespace sta {
+
+    // streaming reader of one json document of a taint_info file.
+    // the SAX events of nlohmann::json are written into the final std containers directly,
+    // so that no json DOM is built. the layout is the one of nlohmann's to_json:
+    // a map with string keys is an object, a map with other keys is an array of [key, value],
+    // a set, a vector and a tuple are arrays.
+
+    // the reader of one value, it writes to the object it targets
+    class SaxReader {
+    public:
+        virtual ~SaxReader() = default;
+
+        // this value is an object or an array
+        virtual bool begin(bool) { return false; }
+
+        // the reader of the next element of this object or array
+        virtual SaxReader *element() { return nullptr; }
+
+        // the last element returned by element() is complete
+        virtual void finish() {}
+
+        virtual bool key(std::string &) { return false; }
+
+        virtual bool number(uint64_t) { return false; }
+
+        virtual bool number(int64_t) { return false; }
+
+        virtual bool string(std::string &) { return false; }
+    };
+
+    template<class T, class Enable = void>
+    class SaxValue;
+
+    template<class T>
+    class SaxValue<T, typename std::enable_if<std::is_integral<T>::value>::type> : public SaxReader {
+    public:
+        T *target = nullptr;
+
+        bool number(uint64_t v) override {
+            *target = static_cast<T>(v);
+            return true;
+        }
+
+        bool number(int64_t v) override {
+            *target = static_cast<T>(v);
+            return true;
+        }
+    };
+
+    template<>
+    class SaxValue<std::string> : public SaxReader {
+    public:
+        std::string *target = nullptr;
+
+        bool string(std::string &s) override {
+            *target = std::move(s);
+            return true;
+        }
+    };
+
+    // map with string keys: {"key": value, ...}
+    template<class V>
+    class SaxValue<std::map<std::string, V>> : public SaxReader {
+    public:
+        std::map<std::string, V> *target = nullptr;
+
+        bool begin(bool object) override {
+            return object;
+        }
+
+        bool key(std::string &k) override {
+            slot = &(*target)[std::move(k)];
+            return true;
+        }
+
+        SaxReader *element() override {
+            value.target = slot;
+            return &value;
+        }
+
+    private:
+        V *slot = nullptr;
+        SaxValue<V> value;
+    };
+
+    // one [key, value] of a map with other keys
+    template<class K, class V>
+    class SaxPair : public SaxReader {
+    public:
+        std::map<K, V> *target = nullptr;
+
+        bool begin(bool object) override {
+            index = 0;
+            return !object;
+        }
+
+        SaxReader *element() override {
+            switch (index++) {
+                case 0: {
+                    k = K();
+                    key.target = &k;
+                    return &key;
+                }
+                case 1: {
+                    value.target = &(*target)[k];
+                    return &value;
+                }
+                default: {
+                    return nullptr;
+                }
+            }
+        }
+
+    private:
+        uint32_t index = 0;
+        K k;
+        SaxValue<K> key;
+        SaxValue<V> value;
+    };
+
+    // map with other keys: [[key, value], ...]
+    template<class K, class V>
+    class SaxValue<std::map<K, V>, typename std::enable_if<!std::is_same<K, std::string>::value>::type>
+            : public SaxReader {
+    public:
+        std::map<K, V> *target = nullptr;
+
+        bool begin(bool object) override {
+            return !object;
+        }
+
+        SaxReader *element() override {
+            pair.target = target;
+            return &pair;
+        }
+
+    private:
+        SaxPair<K, V> pair;
+    };
+
+    template<class T>
+    class SaxValue<std::set<T>> : public SaxReader {
+    public:
+        std::set<T> *target = nullptr;
+
+        bool begin(bool object) override {
+            return !object;
+        }
+
+        SaxReader *element() override {
+            t = T();
+            value.target = &t;
+            return &value;
+        }
+
+        void finish() override {
+            target->insert(target->end(), std::move(t));
+        }
+
+    private:
+        T t;
+        SaxValue<T> value;
+    };
+
+    template<class T>
+    class SaxValue<std::vector<T>> : public SaxReader {
+    public:
+        std::vector<T> *target = nullptr;
+
+        bool begin(bool object) override {
+            return !object;
+        }
+
+        SaxReader *element() override {
+            target->emplace_back();
+            value.target = &target->back();
+            return &value;
+        }
+
+    private:
+        SaxValue<T> value;
+    };
+
+    template<class A, class B>
+    class SaxValue<std::tuple<A, B>> : public SaxReader {
+    public:
+        std::tuple<A, B> *target = nullptr;
+
+        bool begin(bool object) override {
+            index = 0;
+            return !object;
+        }
+
+        SaxReader *element() override {
+            switch (index++) {
+                case 0: {
+                    first.target = &std::get<0>(*target);
+                    return &first;
+                }
+                case 1: {
+                    second.target = &std::get<1>(*target);
+                    return &second;
+                }
+                default: {
+                    return nullptr;
+                }
+            }
+        }
+
+    private:
+        uint32_t index = 0;
+        SaxValue<A> first;
+        SaxValue<B> second;
+    };
+
+    // the SAX handler, it keeps the readers of the open objects and arrays
+    class TaintSax : public nlohmann::json_sax<nlohmann::json> {
+    public:
+        explicit TaintSax(SaxReader *root) : root(root) {}
+
+        bool null() override {
+            return false;
+        }
+
+        bool boolean(bool) override {
+            return false;
+        }
+
+        bool number_integer(number_integer_t val) override {
+            SaxReader *r = next();
+            return r != nullptr && r->number(static_cast<int64_t>(val)) && done();
+        }
+
+        bool number_unsigned(number_unsigned_t val) override {
+            SaxReader *r = next();
+            return r != nullptr && r->number(static_cast<uint64_t>(val)) && done();
+        }
+
+        bool number_float(number_float_t, const string_t &) override {
+            return false;
+        }
+
+        bool string(string_t &val) override {
+            SaxReader *r = next();
+            return r != nullptr && r->string(val) && done();
+        }
+
+        bool start_object(std::size_t) override {
+            return open(true);
+        }
+
+        bool key(string_t &val) override {
+            return !stack.empty() && stack.back()->key(val);
+        }
+
+        bool end_object() override {
+            stack.pop_back();
+            return done();
+        }
+
+        bool start_array(std::size_t) override {
+            return open(false);
+        }
+
+        bool end_array() override {
+            stack.pop_back();
+            return done();
+        }
+
+        bool parse_error(std::size_t, const std::string &, const nlohmann::detail::exception &ex) override {
+            error = ex.what();
+            return false;
+        }
+
+        std::string error;
+
+    private:
+        SaxReader *root;
+        std::vector<SaxReader *> stack;
+
+        SaxReader *next() {
+            if (stack.empty()) {
+                SaxReader *r = root;
+                root = nullptr;
+                return r;
+            }
+            return stack.back()->element();
+        }
+
+        bool open(bool object) {
+            SaxReader *r = next();
+            if (r == nullptr || !r->begin(object)) {
+                return false;
+            }
+            stack.push_back(r);
+            return true;
+        }
+
+        bool done() {
+            if (!stack.empty()) {
+                stack.back()->finish();
+            }
+            return true;
+        }
+    };
+
+    // read the next json document of the stream into res
+    template<class T>
+    bool readTaint(std::istream &in, T &res) {
+        res = T();
+        SaxValue<T> value;
+        value.target = &res;
+        TaintSax sax(&value);
+        if (!nlohmann::json::sax_parse(nlohmann::detail::input_adapter(in), &sax,
+                                       nlohmann::detail::input_format_t::json, false)) {
+            if (sax.error.empty()) {
+                std::cerr << "unexpected type in the static analysis results" << std::endl;
+            } else {
+                std::cerr << sax.error << std::endl;
+            }
+            return false;
+        }
+        return true;
+    }
+
+} /* namespace sta */
+
+#endif /* LIB_STA_TAINTSAX_H_ */
@@ -0,0 +1,130 @@
+/*
+ * WriteTable.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "WriteTable.h"
+
+#include <llvm/Support/MemoryBuffer.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include "../DCC/general.h"
+
+namespace sta {
+
+    const uint64_t WriteTable::Magic = 0x5345544952575230; // "0RWRITES"
+    const uint32_t WriteTable::Version = 1;
+
+    namespace {
+        struct Header {
+            uint64_t magic;
+            uint32_t version;
+            uint32_t number_site;
+            uint64_t key[2];
+            uint64_t number_condition;
+            uint64_t number_mod;
+            uint64_t size;
+        };
+
+        bool less(const WriteTable::Condition &a, const WriteTable::Condition &b) {
+            return a.address < b.address || (a.address == b.address && a.branch < b.branch);
+        }
+    } /* namespace */
+
+    WriteTable::WriteTable() : Conditions(nullptr), NumberCondition(0), Mods(nullptr), NumberMod(0) {}
+
+    WriteTable::~WriteTable() = default;
+
+    bool WriteTable::open(const std::string &path, const uint64_t key[2], uint32_t number_site) {
+        // the parts are read in place, so the buffer has to be aligned, which a mapped file is
+        auto buffer = dra::mapFile(path);
+        if (!buffer) {
+            return false;
+        }
+        llvm::StringRef file = (*buffer)->getBuffer();
+        Header h{};
+        if (file.size() < sizeof(h)) {
+            std::cerr << "broken write table " << path << std::endl;
+            return false;
+        }
+        memcpy(&h, file.data(), sizeof(h));
+        if (h.magic != Magic || h.version != Version) {
+            std::cerr << "write table " << path << " has another version, precompute it again" << std::endl;
+            return false;
+        }
+        if (h.key[0] != key[0] || h.key[1] != key[1] || h.number_site != number_site) {
+            std::cerr << "write table " << path << " is not of this taint_info file and kernel" << std::endl;
+            return false;
+        }
+        // a file cut by a crash is never used
+        if (h.size != file.size() || h.number_condition > file.size() / sizeof(Condition) ||
+            h.number_mod > file.size() / sizeof(Mod) ||
+            sizeof(h) + h.number_condition * sizeof(Condition) + h.number_mod * sizeof(Mod) != file.size() ||
+            reinterpret_cast<uintptr_t>(file.data()) % alignof(Condition) != 0) {
+            std::cerr << "broken write table " << path << std::endl;
+            return false;
+        }
+        this->Conditions = reinterpret_cast<const Condition *>(file.data() + sizeof(h));
+        this->NumberCondition = h.number_condition;
+        this->Mods = reinterpret_cast<const Mod *>(this->Conditions + h.number_condition);
+        this->NumberMod = h.number_mod;
+        for (uint64_t i = 0; i < this->NumberCondition; i++) {
+            const Condition &c = this->Conditions[i];
+            if (c.number > 0 && (c.first > this->NumberMod || (uint64_t) c.number > this->NumberMod - c.first)) {
+                std::cerr << "broken write table " << path << std::endl;
+                this->Conditions = nullptr;
+                this->NumberCondition = 0;
+                return false;
+            }
+        }
+        this->Buffer = std::move(*buffer);
+        return true;
+    }
+
+    const WriteTable::Condition *WriteTable::find(uint64_t address, uint32_t branch) const {
+        Condition key{address, branch, 0, 0};
+        const Condition *end = this->Conditions + this->NumberCondition;
+        const Condition *it = std::lower_bound(this->Conditions, end, key, less);
+        if (it == end || it->address != address || it->branch != branch) {
+            return nullptr;
+        }
+        return it;
+    }
+
+    const WriteTable::Mod *WriteTable::getMods(const Condition *c) const {
+        return this->Mods + c->first;
+    }
+
+    bool WriteTable::write(const std::string &path, const uint64_t key[2], uint32_t number_site,
+                           std::vector<Condition> &conditions, const std::vector<Mod> &mods) {
+        std::sort(conditions.begin(), conditions.end(), less);
+        Header h{};
+        h.magic = Magic;
+        h.version = Version;
+        h.number_site = number_site;
+        h.key[0] = key[0];
+        h.key[1] = key[1];
+        h.number_condition = conditions.size();
+        h.number_mod = mods.size();
+        h.size = sizeof(h) + conditions.size() * sizeof(Condition) + mods.size() * sizeof(Mod);
+
+        std::string temp = path + ".tmp";
+        std::ofstream output(temp, std::ios::out | std::ios::trunc | std::ios::binary);
+        output.write(reinterpret_cast<const char *>(&h), sizeof(h));
+        output.write(reinterpret_cast<const char *>(conditions.data()), conditions.size() * sizeof(Condition));
+        output.write(reinterpret_cast<const char *>(mods.data()), mods.size() * sizeof(Mod));
+        output.close();
+        if (!output || std::rename(temp.c_str(), path.c_str()) != 0) {
+            std::cerr << "Failed to write the write table " << path << std::endl;
+            std::remove(temp.c_str());
+            return false;
+        }
+        return true;
+    }
+
+} /* namespace sta */
@@ -0,0 +1,79 @@
+/*
+ * WriteTable.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef LIB_STA_WRITETABLE_H_
+#define LIB_STA_WRITETABLE_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace llvm {
+    class MemoryBuffer;
+} /* namespace llvm */
+
+namespace sta {
+
+    // The precomputed results of GetAllGlobalWriteBBs for every (condition, successor) of a kernel,
+    // written by dra -precompute and looked up by the trace_pc address of the condition.
+    // The table belongs to one taint_info file and one kernel (objdump and bit code), identified by their hashes.
+    //
+    // layout, little endian, every part starts at a multiple of 8 bytes:
+    //   header: magic, version, number of mod BB ids of the taint_info file, the two hashes,
+    //           number of conditions, number of mods, size of the file
+    //   conditions: Condition sorted by (address, branch)
+    //   mods: Mod, the mods of one condition are consecutive in the order of the query result
+    class WriteTable {
+    public:
+        struct Condition {
+            uint64_t address;
+            uint32_t branch;
+            // -1: the condition is not tainted (GetAllGlobalWriteBBs returned nullptr)
+            int32_t number;
+            uint64_t first;
+        };
+
+        struct Mod {
+            // the id of the ModSite in its StaticAnalysisResult
+            uint32_t site;
+            int32_t prio;
+            int64_t repeat;
+            uint32_t from_nlp;
+            uint32_t reserved;
+        };
+
+        WriteTable();
+
+        virtual ~WriteTable();
+
+        // false if the file is missing, broken or of another taint_info file or kernel
+        bool open(const std::string &path, const uint64_t key[2], uint32_t number_site);
+
+        // nullptr if the (address, branch) pair is not in the table
+        const Condition *find(uint64_t address, uint32_t branch) const;
+
+        const Mod *getMods(const Condition *c) const;
+
+        // the conditions are sorted here, the mods of a condition are mods[first] ... mods[first + number - 1]
+        static bool write(const std::string &path, const uint64_t key[2], uint32_t number_site,
+                          std::vector<Condition> &conditions, const std::vector<Mod> &mods);
+
+    public:
+        static const uint64_t Magic;
+        static const uint32_t Version;
+
+    private:
+        std::unique_ptr<llvm::MemoryBuffer> Buffer;
+        const Condition *Conditions;
+        uint64_t NumberCondition;
+        const Mod *Mods;
+        uint64_t NumberMod;
+    };
+
+} /* namespace sta */
+
+#endif /* LIB_STA_WRITETABLE_H_ */
@@ -17,6 +17,10 @@ llvm::cl::opt<std::string> obj_dump("objdump", llvm::cl::desc("The obj dump file
                                     llvm::cl::init("./vmlinux.objdump"));
 llvm::cl::opt<std::string> assembly("asm", llvm::cl::desc("The assembly source code."), llvm::cl::init("./built-in.s"));
 llvm::cl::opt<std::string> bit_code("bc", llvm::cl::desc("The bit code."), llvm::cl::init("./built-in.bc"));
+llvm::cl::opt<bool> snapshot("snapshot", llvm::cl::desc("Load and save the module snapshot next to the obj dump."),
+                             llvm::cl::init(true));
+llvm::cl::opt<bool> lazy("lazy", llvm::cl::desc("Load the function bodies of the bit code on first use, needs the snapshot."),
+                         llvm::cl::init(false));
 
 llvm::cl::opt<std::string> config(llvm::cl::Positional, llvm::cl::desc("The dra config file"),
                                   llvm::cl::init("dra.json"));
@@ -40,6 +44,8 @@ int main(int argc, char **argv) {
 #endif
 
     auto *dcc = new dra::DependencyControlCenter();
+    dcc->setSnapshot(snapshot);
+    dcc->setLazy(lazy);
 
     dcc->init(obj_dump, assembly, bit_code, config);
     dcc->check_coverage(union_coverage);
@@ -3,15 +3,63 @@
 // from binary get address line number.
 //
 
+#include <llvm/Config/llvm-config.h>
+#include <llvm/DebugInfo/Symbolize/Symbolize.h>
 #include <llvm/Support/CommandLine.h>
+#include <llvm/Support/FileSystem.h>
 #include <sstream>
 #include <fstream>
+#include <iostream>
+#include <thread>
+#include <vector>
 #include "../../lib/RPC/Dependency.pb.h"
 
 #define TEST 0
 #define DEBUG_OBJ_DUMP 0
 
 llvm::cl::opt<std::string> objdump("objdump", llvm::cl::desc("The path of objdump."), llvm::cl::init("./vmlinux.objdump"));
+#if TEST
+llvm::cl::opt<std::string> marker("marker", llvm::cl::desc("The path is the part of the file name after the marker."),
+                                  llvm::cl::init("c-f/"));
+#else
+llvm::cl::opt<std::string> marker("marker", llvm::cl::desc("The path is the part of the file name after the marker."),
+                                  llvm::cl::init("-np/"));
+#endif
+llvm::cl::opt<unsigned> thread("thread", llvm::cl::desc("The number of threads, 0 means all cores. Every thread keeps "
+                                                              "its own symbol table and parsed DWARF of the binary, "
+                                                              "so the memory grows with the number of threads."),
+                               llvm::cl::init(4));
+
+struct function_address {
+    std::string Addr;
+    uint64_t address;
+    std::string Path;
+};
+
+// the same path as the last line of addr2line -afi: the file of the outermost inlined frame
+std::string getPath(llvm::symbolize::LLVMSymbolizer &symbolizer, const std::string &obj, uint64_t address) {
+#if LLVM_VERSION_MAJOR >= 9
+    auto info = symbolizer.symbolizeInlinedCode(obj, {address, llvm::object::SectionedAddress::UndefSection});
+#else
+    auto info = symbolizer.symbolizeInlinedCode(obj, address);
+#endif
+    if (!info) {
+        llvm::consumeError(info.takeError());
+        return "";
+    }
+    if (info->getNumberOfFrames() == 0) {
+        return "";
+    }
+    std::string FileName = info->getFrame(info->getNumberOfFrames() - 1).FileName;
+    if (FileName == "<invalid>") {
+        return "";
+    }
+    unsigned long start = FileName.find(marker);
+    if (start < FileName.size()) {
+        return FileName.substr(start + marker.size());
+    }
+    return FileName;
+}
 
 int main(int argc, char **argv) {
 
@@ -20,23 +68,27 @@ int main(int argc, char **argv) {
 
     std::string Line;
     std::string Addr;
-    std::string FunctionName;
-    std::string Path;
-    std::string cmd;
-    std::string Result;
     std::stringstream ss;
-    unsigned long end;
-    unsigned long start;
+    std::vector<function_address> functions;
 
     // get path
     std::string obj = objdump.substr(0, objdump.find(".objdump"));
+#if TEST
+    std::string binary = obj + ".o";
+#else
+    std::string binary = obj;
+#endif
 
 #if DEBUG_OBJ_DUMP
     std::cout << "objdump :" << objdump << std::endl;
 #endif
 
+    if (!llvm::sys::fs::exists(binary)) {
+        std::cerr << "Unable to open binary file " << binary << "\n";
+        return -1;
+    }
+
     std::ifstream objdumpFile(objdump);
-    FunctionName = "";
     if (objdumpFile.is_open()) {
         while (getline(objdumpFile, Line)) {
             if (!Line.empty()) {
@@ -52,57 +104,10 @@ int main(int argc, char **argv) {
 #if DEBUG_OBJ_DUMP
                     std::cout << "o Addr :" << Addr << std::endl;
 #endif
-
-
-                    // get function name
-                    ss.str("");
-                    start = Line.find('<');
-                    end = Line.find('>');
-                    for (unsigned long i = start + 1; i < end; i++) {
-                        ss << Line.at(i);
-                    }
-                    FunctionName = ss.str();
-#if DEBUG_OBJ_DUMP
-                    std::cout << "o FunctionName :" << FunctionName << std::endl;
-#endif
-
-#if TEST
-                    cmd = "addr2line -afi -e " + obj + ".o " + Addr;
-#else
-                    cmd = "addr2line -afi -e " + obj + " " + Addr;
-#endif
-
-                    FILE *stream;
-                    const int max_buffer = 1024;
-                    char buffer[max_buffer];
-                    cmd.append(" 2>&1");
-
-                    stream = popen(cmd.c_str(), "r");
-                    if (stream) {
-                        while (!feof(stream))
-                            if (fgets(buffer, max_buffer, stream) != nullptr)
-                                Result = buffer;
-                        pclose(stream);
-                    }
-#if DEBUG_OBJ_DUMP
-                    std::cout << "Result :" << Result << std::endl;
-#endif
-                    ss.str("");
-#if TEST
-                    start = Result.find("c-f/");
-#else
-                    start = Result.find("-np/");
-//                    start = Result.find(".16/");
-#endif
-                    end = Result.find(':');
-                    for (unsigned long i = start + 4; i < end; i++) {
-                        ss << Result.at(i);
-                    }
-                    Path = ss.str();
-#if DEBUG_OBJ_DUMP
-                    std::cout << "o Path :" << Path << std::endl;
-#endif
-                    (*a->mutable_addr())[Addr] = Path;
+                    function_address f;
+                    f.Addr = Addr;
+                    f.address = std::stoull(Addr, nullptr, 16);
+                    functions.push_back(f);
                 }
             }
         }
@@ -111,6 +116,37 @@ int main(int argc, char **argv) {
         std::cerr << "Unable to open objdump file " << objdump << "\n";
     }
 
+    // every thread owns a symbolizer and a contiguous range of functions,
+    // so that it only parses the compile units of its part of the binary.
+    unsigned long number_thread = thread;
+    if (number_thread == 0) {
+        number_thread = std::thread::hardware_concurrency();
+    }
+    if (number_thread == 0) {
+        number_thread = 1;
+    }
+    unsigned long shard = (functions.size() + number_thread - 1) / number_thread;
+    std::vector<std::thread> workers;
+    for (unsigned long t = 0; t < number_thread && t * shard < functions.size(); t++) {
+        workers.emplace_back([&functions, &binary, shard, t]() {
+            llvm::symbolize::LLVMSymbolizer symbolizer;
+            unsigned long end = std::min<unsigned long>((t + 1) * shard, functions.size());
+            for (unsigned long i = t * shard; i < end; i++) {
+                functions[i].Path = getPath(symbolizer, binary, functions[i].address);
+            }
+        });
+    }
+    for (auto &w : workers) {
+        w.join();
+    }
+
+    for (const auto &f : functions) {
+#if DEBUG_OBJ_DUMP
+        std::cout << "o Path :" << f.Path << std::endl;
+#endif
+        (*a->mutable_addr())[f.Addr] = f.Path;
+    }
+
     // Write back to disk.
     std::string output_file = obj + ".bin";
     std::fstream output(output_file, std::ios::out | std::ios::trunc | std::ios::binary);
@@ -121,4 +157,4 @@ int main(int argc, char **argv) {
     output.close();
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,1230 @@
+/*
+ * bench.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *  compare the loaders and indexes against the old implementations on the same input.
+ */
+#include <llvm/Support/Signals.h>
+#include <llvm/ADT/StringRef.h>
+#include <llvm/Support/CommandLine.h>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "../../lib/DCC/general.h"
+#include "../../lib/DMM/DataManagement.h"
+#include "../../lib/DMM/DModule.h"
+#include "../../lib/DMM/DSnapshot.h"
+#include "../../lib/DMM/DSymbol.h"
+#include "../../lib/STA/StaticAnalysisResult.h"
+#include "../../lib/STA/TaintFile.h"
+#include "../../lib/JSON/json.cpp"
+
+llvm::cl::opt<std::string> mode("mode", llvm::cl::desc("The benchmark: objdump, asm, snapshot, lazy, address, taint, sta, ids, tags, callees, mods, batch, dom, reach, table, devices."), llvm::cl::init("objdump"));
+llvm::cl::opt<std::string> obj_dump("objdump", llvm::cl::desc("The obj dump file."),
+                                    llvm::cl::init("./vmlinux.objdump"));
+llvm::cl::opt<std::string> assembly("asm", llvm::cl::desc("The assembly source code."), llvm::cl::init("./built-in.s"));
+llvm::cl::opt<std::string> bit_code("bc", llvm::cl::desc("The bit code, empty means skip it."), llvm::cl::init(""));
+llvm::cl::opt<std::string> taint("taint", llvm::cl::desc("The taint_info file of the static analysis."),
+                                 llvm::cl::init("./taint_info_serialize"));
+llvm::cl::opt<unsigned> thread("thread", llvm::cl::desc("The number of threads, 0 means all cores."),
+                               llvm::cl::init(0));
+
+double seconds(const std::function<void()> &f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+    return d.count();
+}
+
+bool same_function(dra::DFunction *a, dra::DFunction *b) {
+    if (a->Address != b->Address || a->InstNum != b->InstNum || a->CallInstNum != b->CallInstNum ||
+        a->JumpInstNum != b->JumpInstNum || a->InstASM.size() != b->InstASM.size()) {
+        return false;
+    }
+    for (unsigned long i = 0; i < a->InstASM.size(); i++) {
+        auto *x = a->InstASM[i];
+        auto *y = b->InstASM[i];
+        if (x->address != y->address || x->OInst != y->OInst || x->SInst != y->SInst ||
+            x->BasicBlockName != y->BasicBlockName || (x->parent == nullptr) != (y->parent == nullptr) ||
+            (x->parent != nullptr && x->parent->name != y->parent->name)) {
+            return false;
+        }
+    }
+    if (a->BasicBlock.size() != b->BasicBlock.size()) {
+        return false;
+    }
+    for (auto &it : a->BasicBlock) {
+        auto bb = b->BasicBlock.find(it.first);
+        if (bb == b->BasicBlock.end()) {
+            return false;
+        }
+        auto *x = it.second;
+        auto *y = bb->second;
+        if (x->isAsmSourceCode() != y->isAsmSourceCode() || x->trace_pc_address != y->trace_pc_address ||
+            x->tracr_num != y->tracr_num || x->InstASM.size() != y->InstASM.size()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// the model of the old parser and the new parser should be the same
+uint64_t compare_module(dra::DModule *a, dra::DModule *b) {
+    uint64_t diff = 0;
+    if (a->Function.size() != b->Function.size()) {
+        std::cerr << "different number of path : " << a->Function.size() << " " << b->Function.size() << std::endl;
+        diff++;
+    }
+    for (auto &p : a->Function) {
+        auto it = b->Function.find(p.first);
+        for (auto &f : p.second) {
+            if (it == b->Function.end() || it->second.find(f.first) == it->second.end() ||
+                !same_function(f.second, it->second[f.first])) {
+                std::cerr << "different function : " << dra::DSymbol::name(p.first).str() << " "
+                          << dra::DSymbol::name(f.first).str() << std::endl;
+                diff++;
+            }
+        }
+    }
+    return diff;
+}
+
+uint64_t bench_objdump() {
+    auto *serial = new dra::DModule();
+    auto *parallel = new dra::DModule();
+    if (thread != 0) {
+        parallel->NumberThread = thread;
+    }
+    if (parallel->NumberThread <= 1) {
+        parallel->NumberThread = 2;
+    }
+    double t_serial = seconds([&]() { serial->ReadObjdumpSerial(obj_dump); });
+    double t_parallel = seconds([&]() { parallel->ReadObjdump(obj_dump); });
+    std::cout << "objdump : " << obj_dump << std::endl;
+    std::cout << "serial : " << t_serial << " s" << std::endl;
+    std::cout << "parallel : " << t_parallel << " s with " << parallel->NumberThread << " threads" << std::endl;
+    std::cout << "speedup : " << t_serial / t_parallel << std::endl;
+    uint64_t diff = compare_module(serial, parallel);
+    std::cout << "different function : " << diff << std::endl;
+    return diff;
+}
+
+uint64_t bench_asm() {
+    auto *serial = new dra::DModule();
+    auto *parallel = new dra::DModule();
+    if (thread != 0) {
+        parallel->NumberThread = thread;
+    }
+    if (parallel->NumberThread <= 1) {
+        parallel->NumberThread = 2;
+    }
+    for (auto *m : {serial, parallel}) {
+        if (!bit_code.empty()) {
+            m->ReadBC(bit_code);
+        }
+        m->ReadObjdump(obj_dump);
+    }
+    double t_serial = seconds([&]() { serial->ReadAsmSourceCodeSerial(assembly); });
+    double t_parallel = seconds([&]() { parallel->ReadAsmSourceCode(assembly); });
+    uint64_t trace_pc = 0;
+    for (auto &p : parallel->Function) {
+        for (auto &f : p.second) {
+            for (auto &b : f.second->BasicBlock) {
+                trace_pc += b.second->trace_pc_address != 0;
+            }
+        }
+    }
+    std::cout << "asm : " << assembly << std::endl;
+    std::cout << "basic block with trace_pc : " << trace_pc << std::endl;
+    std::cout << "serial : " << t_serial << " s" << std::endl;
+    std::cout << "parallel : " << t_parallel << " s with " << parallel->NumberThread << " threads" << std::endl;
+    std::cout << "speedup : " << t_serial / t_parallel << std::endl;
+    uint64_t diff = compare_module(serial, parallel);
+    std::cout << "different function : " << diff << std::endl;
+    return diff;
+}
+
+// cold start without snapshot, cold start writing the snapshot, warm start reading it
+uint64_t bench_snapshot() {
+    auto *parse = new dra::DataManagement();
+    auto *cold = new dra::DataManagement();
+    auto *warm = new dra::DataManagement();
+    parse->useSnapshot = false;
+    dra::DSnapshot snapshot(obj_dump, assembly, bit_code, 1);
+    std::remove(snapshot.Path.c_str());
+
+    double t_parse = seconds([&]() { parse->initializeModule(obj_dump, assembly, bit_code); });
+    double t_cold = seconds([&]() { cold->initializeModule(obj_dump, assembly, bit_code); });
+    double t_warm = seconds([&]() { warm->initializeModule(obj_dump, assembly, bit_code); });
+    std::cout << "snapshot : " << snapshot.Path << std::endl;
+    std::cout << "parse : " << t_parse << " s" << std::endl;
+    std::cout << "parse and write snapshot : " << t_cold << " s" << std::endl;
+    std::cout << "read snapshot : " << t_warm << " s" << std::endl;
+    uint64_t diff_function = compare_module(parse->Modules, warm->Modules);
+    std::cout << "different function : " << diff_function << std::endl;
+
+    uint64_t diff = parse->AddressIndex.size() != warm->AddressIndex.size();
+    for (uint64_t i = 0; i < parse->AddressIndex.size(); i++) {
+        auto *p = parse->AddressIndex.Inst[i];
+        auto *w = warm->AddressIndex.find(parse->AddressIndex.Address[i]);
+        if (w == nullptr || w->address != p->address || (w->parent == nullptr) != (p->parent == nullptr) ||
+            (w->parent != nullptr && w->parent->name != p->parent->name)) {
+            diff++;
+        }
+    }
+    std::cout << "different address : " << diff << std::endl;
+    return diff_function + diff;
+}
+
+// resident memory of this process in MB
+double resident() {
+    std::ifstream statm("/proc/self/statm");
+    uint64_t size = 0, rss = 0;
+    statm >> size >> rss;
+    return (double) rss * sysconf(_SC_PAGESIZE) / (1024 * 1024);
+}
+
+// warm start with the whole bit code against warm start with lazily loaded function bodies
+uint64_t bench_lazy() {
+    dra::DSnapshot snapshot(obj_dump, assembly, bit_code, 1);
+    std::ifstream exist(snapshot.Path);
+    if (!exist.good()) {
+        auto *cold = new dra::DataManagement();
+        cold->initializeModule(obj_dump, assembly, bit_code);
+        delete cold;
+    }
+
+    auto *lazy = new dra::DataManagement();
+    lazy->Modules->Lazy = true;
+    double m_lazy = resident();
+    double t_lazy = seconds([&]() { lazy->initializeModule(obj_dump, assembly, bit_code); });
+    m_lazy = resident() - m_lazy;
+
+    auto *eager = new dra::DataManagement();
+    double m_eager = resident();
+    double t_eager = seconds([&]() { eager->initializeModule(obj_dump, assembly, bit_code); });
+    m_eager = resident() - m_eager;
+
+    uint64_t materialized = 0;
+    for (auto *f : lazy->Modules->AllFunction) {
+        materialized += f->Materialized;
+    }
+    std::cout << "eager : " << t_eager << " s " << m_eager << " MB" << std::endl;
+    std::cout << "lazy : " << t_lazy << " s " << m_lazy << " MB" << std::endl;
+    std::cout << "materialized function : " << materialized << " / " << lazy->Modules->AllFunction.size()
+              << std::endl;
+
+    double t_all = seconds([&]() {
+        for (auto *f : lazy->Modules->AllFunction) {
+            f->materialize();
+        }
+    });
+    std::cout << "materialize all functions : " << t_all << " s" << std::endl;
+    uint64_t diff = compare_module(eager->Modules, lazy->Modules);
+    diff += eager->Modules->NumberBasicBlock != lazy->Modules->NumberBasicBlock;
+    diff += eager->Modules->NumberBasicBlockReal != lazy->Modules->NumberBasicBlockReal;
+    for (auto &p : eager->Modules->Function) {
+        for (auto &f : p.second) {
+            auto *l = lazy->Modules->Function[p.first][f.first];
+            for (auto &b : f.second->BasicBlock) {
+                if (l == nullptr || l->BasicBlock.find(b.first) == l->BasicBlock.end()) {
+                    continue;
+                }
+                auto *lb = l->BasicBlock[b.first];
+                if ((b.second->basicBlock == nullptr) != (lb->basicBlock == nullptr) ||
+                    b.second->InstIR.size() != lb->InstIR.size() ||
+                    (b.second->parent == nullptr) != (lb->parent == nullptr)) {
+                    diff++;
+                }
+            }
+        }
+    }
+    std::cout << "different function : " << diff << std::endl;
+    return diff;
+}
+
+// coverage lookups in an unordered_map against the sorted address index, one by one and per call
+uint64_t bench_address() {
+    auto *dm = new dra::DataManagement();
+    dm->initializeModule(obj_dump, assembly, bit_code);
+
+    // calls of 2000 addresses, nine of ten are trace_pc addresses
+    std::vector<uint64_t> known(dm->AddressIndex.Address);
+    std::unordered_map<uint64_t, dra::DAInstruction *> address2inst;
+    address2inst.reserve(known.size());
+    for (uint64_t i = 0; i < known.size(); i++) {
+        address2inst[known[i]] = dm->AddressIndex.Inst[i];
+    }
+    std::mt19937_64 random(1);
+    std::vector<std::vector<uint64_t>> calls(1000);
+    for (auto &c : calls) {
+        for (uint32_t i = 0; i < 2000; i++) {
+            uint64_t a = known[random() % known.size()];
+            c.push_back(random() % 10 == 0 ? a + 1 : a);
+        }
+    }
+
+    uint64_t found_map = 0, found_index = 0, found_batch = 0;
+    double t_map = seconds([&]() {
+        for (auto &c : calls) {
+            for (auto a : c) {
+                auto it = address2inst.find(a);
+                if (it != address2inst.end()) {
+                    found_map += it->second->address == a;
+                }
+            }
+        }
+    });
+    double t_index = seconds([&]() {
+        for (auto &c : calls) {
+            for (auto a : c) {
+                auto inst = dm->AddressIndex.find(a);
+                if (inst != nullptr) {
+                    found_index += inst->address == a;
+                }
+            }
+        }
+    });
+    std::vector<dra::DAInstruction *> res;
+    double t_batch = seconds([&]() {
+        for (auto &c : calls) {
+            dm->AddressIndex.find(c, res);
+            for (uint64_t i = 0; i < c.size(); i++) {
+                if (res[i] != nullptr) {
+                    found_batch += res[i]->address == c[i];
+                }
+            }
+        }
+    });
+    std::cout << "address : " << dm->AddressIndex.size() << std::endl;
+    std::cout << "unordered_map : " << t_map << " s" << std::endl;
+    std::cout << "index : " << t_index << " s" << std::endl;
+    std::cout << "index per call : " << t_batch << " s" << std::endl;
+    std::cout << "found : " << found_map << " " << found_index << " " << found_batch << std::endl;
+    return (found_map != found_index) + (found_index != found_batch);
+}
+
+bool same_taint(const TAINT_INFO &a, const TAINT_INFO &b) {
+    return a.taintedBrs == b.taintedBrs && a.ctxMap == b.ctxMap && a.traitMap == b.traitMap &&
+           a.tagModMap == b.tagModMap && a.tagConstMap == b.tagConstMap && a.tagInfo == b.tagInfo &&
+           a.calleeMap == b.calleeMap;
+}
+
+// the old loader: json DOMs converted by get<>
+bool load_dom(TAINT_INFO &t) {
+    try {
+        nlohmann::json j_taintedBrs, j_ctxMap, j_traitMap, j_tagModMap, j_tagConstMap, j_tagInfo, j_calleeMap;
+        std::ifstream infile(taint);
+        infile >> j_taintedBrs >> j_ctxMap >> j_traitMap >> j_tagModMap >> j_tagConstMap >> j_tagInfo
+               >> j_calleeMap;
+        t.taintedBrs = j_taintedBrs.get<TAINTED_BR_TY>();
+        t.ctxMap = j_ctxMap.get<CTX_MAP_TY>();
+        t.traitMap = j_traitMap.get<INST_TRAIT_MAP>();
+        t.tagModMap = j_tagModMap.get<TAG_MOD_MAP_TY>();
+        t.tagConstMap = j_tagConstMap.get<TAG_CONST_MAP_TY>();
+        t.tagInfo = j_tagInfo.get<TAG_INFO_TY>();
+        t.calleeMap = j_calleeMap.get<CALLEE_MAP_TY>();
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+bool load_sax(TAINT_INFO &t) {
+    return sta::TaintFile::readJson(taint, t);
+}
+
+bool load_binary(TAINT_INFO &t) {
+    return sta::TaintFile::readBinary(taint + ".bin", t);
+}
+
+// run the loader in a child process, so that its peak memory is not hidden by the other loader
+void measure(const char *name, bool (*load)(TAINT_INFO &)) {
+    int fd[2];
+    if (pipe(fd) != 0) {
+        return;
+    }
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fd[0]);
+        double base = resident();
+        TAINT_INFO t;
+        bool ok = false;
+        double s = seconds([&]() { ok = load(t); });
+        struct rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        double res[3] = {s, (double) usage.ru_maxrss / 1024 - base, ok ? 1.0 : 0.0};
+        ssize_t n = write(fd[1], res, sizeof(res));
+        _exit(n == sizeof(res) ? 0 : 1);
+    }
+    close(fd[1]);
+    double res[3] = {0, 0, 0};
+    ssize_t n = read(fd[0], res, sizeof(res));
+    close(fd[0]);
+    waitpid(pid, nullptr, 0);
+    if (n != sizeof(res) || res[2] == 0) {
+        std::cerr << name << " : fail to load " << taint << std::endl;
+        return;
+    }
+    std::cout << name << " : " << res[0] << " s, peak " << res[1] << " MB" << std::endl;
+}
+
+// the json DOM loader against the streaming SAX loader and the compiled form of the static analysis results
+uint64_t bench_taint() {
+    std::ifstream exist(taint);
+    if (!exist.good()) {
+        std::cerr << "Unable to open taint_info file " << taint << std::endl;
+        return 1;
+    }
+    exist.seekg(0, std::ios::end);
+    std::cout << "taint : " << taint << " " << (double) exist.tellg() / (1024 * 1024) << " MB" << std::endl;
+    TAINT_INFO dom, sax, binary;
+    bool ok_dom = load_dom(dom);
+    bool ok_sax = load_sax(sax);
+    bool ok_binary = ok_sax && sta::TaintFile::writeBinary(taint + ".bin", sax) && load_binary(binary);
+    if (ok_binary) {
+        std::ifstream compiled(taint + ".bin");
+        compiled.seekg(0, std::ios::end);
+        std::cout << "compiled : " << (double) compiled.tellg() / (1024 * 1024) << " MB" << std::endl;
+    }
+
+    measure("json DOM", load_dom);
+    measure("SAX", load_sax);
+    measure("binary", load_binary);
+    std::remove((taint + ".bin").c_str());
+
+    uint64_t diff = ok_dom != ok_sax || ok_sax != ok_binary || (ok_dom && !same_taint(dom, sax)) ||
+                    (ok_binary && !same_taint(sax, binary));
+    std::cout << "different : " << diff << std::endl;
+    return diff;
+}
+
+// static analysis results over the functions of the bit code:
+// every conditional branch is tainted by three of the tags, every tag is written by some stores.
+void make_taint(dra::DataManagement *dm, TAINT_INFO &info, std::vector<llvm::BasicBlock *> &branches) {
+    sta::StaticAnalysisResult names;
+    names.dm = dm;
+    std::vector<LOC_INF> stores;
+    for (auto *f : dm->Modules->AllFunction) {
+        if (f->isRepeat() || !f->isIR() || f->function == nullptr) {
+            continue;
+        }
+        f->materialize();
+        for (auto &b : *f->function) {
+            auto *br = llvm::dyn_cast<llvm::BranchInst>(b.getTerminator());
+            if (br != nullptr && br->isConditional()) {
+                branches.push_back(&b);
+            }
+            for (auto &i : b) {
+                if (llvm::isa<llvm::StoreInst>(i)) {
+                    stores.push_back({names.getInstStrID(&i), names.getBBStrID(&b), f->FunctionName, f->Path});
+                }
+            }
+        }
+    }
+    std::mt19937_64 random(1);
+    const uint64_t number_tag = 1000;
+    for (uint64_t t = 1; t <= number_tag && !stores.empty(); t++) {
+        auto &tag = info.tagInfo[t];
+        tag["is_global"] = "true";
+        tag["ty"] = "i32";
+        tag["field"] = std::to_string(t % 7);
+        tag["v"] = "@global_" + std::to_string(t % 300);
+        tag["vid"] = std::to_string(t % 300);
+        for (uint32_t k = 0; k < 20; k++) {
+            auto &s = stores[random() % stores.size()];
+            info.tagModMap[t][s[3]][s[2]][s[1]][s[0]][k][1].insert(random() % 16);
+        }
+    }
+    for (auto *b : branches) {
+        LOC_INF *loc = names.getLocInf(b);
+        auto &br = info.taintedBrs[(*loc)[3]][(*loc)[2]][(*loc)[1]];
+        delete loc;
+        std::set<ID_TY> tags;
+        for (uint32_t k = 0; k < 3; k++) {
+            tags.insert(random() % number_tag + 1);
+        }
+        br[random() % 4] = std::make_tuple(0, tags);
+    }
+    for (uint64_t c = 0; c < 1000 && !stores.empty(); c++) {
+        for (uint32_t k = 0; k < 3; k++) {
+            info.ctxMap[c].push_back(stores[random() % stores.size()]);
+        }
+    }
+}
+
+// a compiled taint_info file of this process, removed when it goes out of scope
+struct TaintTemp {
+    explicit TaintTemp(const TAINT_INFO &info, uint32_t number = 0)
+            : path("./bench_taint_info_" + std::to_string(getpid()) + "_" + std::to_string(number) + ".bin") {
+        if (!sta::TaintFile::writeBinary(path, info)) {
+            std::cerr << "Unable to write taint_info file " << path << std::endl;
+        }
+    }
+
+    ~TaintTemp() {
+        std::remove(path.c_str());
+    }
+
+    const std::string path;
+};
+
+// the setup of the benchmarks of the static analysis results: the module, the results of make_taint over it in a
+// compiled file and the tainted branches
+struct TaintFixture {
+    TaintFixture() : dm(new dra::DataManagement()) {
+        dm->initializeModule(obj_dump, assembly, bit_code);
+        make_taint(dm, info, branches);
+        file.reset(new TaintTemp(info));
+    }
+
+    // fresh results read from the file, load_time is the time of initStaticRes
+    sta::StaticAnalysisResult *load(double *load_time = nullptr) const {
+        auto *sar = new sta::StaticAnalysisResult();
+        double t = seconds([&]() { sar->initStaticRes(file->path, dm); });
+        if (load_time != nullptr) {
+            *load_time = t;
+        }
+        return sar;
+    }
+
+    dra::DataManagement *dm;
+    TAINT_INFO info;
+    std::vector<llvm::BasicBlock *> branches;
+    std::unique_ptr<TaintTemp> file;
+};
+
+// queries of the mod BBs for all tainted branches, with the location strings resolved per query and with the index
+uint64_t bench_sta() {
+    TaintFixture fixture;
+    auto &info = fixture.info;
+    auto &branches = fixture.branches;
+    double t_load = 0;
+    auto *sar = fixture.load(&t_load);
+    // every query resolves the mods again, otherwise the second round only reads the pool
+    sar->useModPool = false;
+
+    uint64_t number_mod = 0;
+    auto query = [&](std::vector<std::set<std::pair<llvm::BasicBlock *, llvm::Instruction *>>> &res) {
+        res.clear();
+        for (auto *b : branches) {
+            res.emplace_back();
+            sta::MODS *mods = sar->GetAllGlobalWriteBBs(b, 0);
+            if (mods == nullptr) {
+                continue;
+            }
+            for (auto *m : *mods) {
+                res.back().insert(std::make_pair(m->B, m->I));
+            }
+            sta::StaticAnalysisResult::releaseMods(mods);
+        }
+    };
+    std::vector<std::set<std::pair<llvm::BasicBlock *, llvm::Instruction *>>> before, after;
+    // the successors and dominator trees are cached by the first round
+    query(after);
+    sar->useLocationIndex = false;
+    double t_before = seconds([&]() { query(before); });
+    sar->useLocationIndex = true;
+    double t_after = seconds([&]() { query(after); });
+    for (auto &r : after) {
+        number_mod += r.size();
+    }
+
+    std::vector<llvm::Instruction *> ctx;
+    sar->useLocationIndex = false;
+    double t_ctx_before = seconds([&]() {
+        for (auto &c : info.ctxMap) {
+            sar->getCtx(c.first, &ctx);
+        }
+    });
+    sar->useLocationIndex = true;
+    double t_ctx_after = seconds([&]() {
+        for (auto &c : info.ctxMap) {
+            sar->getCtx(c.first, &ctx);
+        }
+    });
+
+    std::cout << "tainted branch : " << branches.size() << " mod : " << number_mod << std::endl;
+    std::cout << "load with index : " << t_load << " s" << std::endl;
+    std::cout << "GetAllGlobalWriteBBs by strings : " << t_before << " s, "
+              << branches.size() / t_before << " queries/s" << std::endl;
+    std::cout << "GetAllGlobalWriteBBs by index : " << t_after << " s, "
+              << branches.size() / t_after << " queries/s" << std::endl;
+    std::cout << "getCtx by strings : " << t_ctx_before << " s" << std::endl;
+    std::cout << "getCtx by index : " << t_ctx_after << " s" << std::endl;
+    std::cout << "different : " << (before != after) << std::endl;
+    return before != after;
+}
+
+// the old string ids: a walk of the parent on the first query, memoized in a map
+std::string &old_bb_id(llvm::BasicBlock *B) {
+    static std::map<llvm::BasicBlock *, std::string> BBNameMap;
+    if (BBNameMap.find(B) == BBNameMap.end()) {
+        if (!B->getName().empty()) {
+            BBNameMap[B] = B->getName().str();
+        } else {
+            int no = 0;
+            for (llvm::BasicBlock &bb : *(B->getParent())) {
+                if (&bb == B) {
+                    BBNameMap[B] = std::to_string(no);
+                    break;
+                }
+                ++no;
+            }
+        }
+    }
+    return BBNameMap[B];
+}
+
+std::string &old_inst_id(llvm::Instruction *I) {
+    static std::map<llvm::Instruction *, std::string> InstNameNoMap;
+    if (InstNameNoMap.find(I) == InstNameNoMap.end()) {
+        int no = 0;
+        for (llvm::Instruction &i : *(I->getParent())) {
+            if (&i == I) {
+                InstNameNoMap[I] = std::to_string(no);
+                break;
+            }
+            ++no;
+        }
+    }
+    return InstNameNoMap[I];
+}
+
+// string ids of all basic blocks and instructions, twice, with the old memoized walk and with the numbering
+uint64_t bench_ids() {
+    auto *dm = new dra::DataManagement();
+    dm->initializeModule(obj_dump, assembly, bit_code);
+    dm->Modules->materializeAll();
+    sta::StaticAnalysisResult sar;
+    sar.dm = dm;
+    std::vector<llvm::Instruction *> insts;
+    for (auto &f : *dm->Modules->module) {
+        for (auto &b : f) {
+            for (auto &i : b) {
+                insts.push_back(&i);
+            }
+        }
+    }
+    uint64_t diff = 0;
+    double t_old = seconds([&]() {
+        for (uint32_t round = 0; round < 2; round++) {
+            for (auto *i : insts) {
+                diff += old_inst_id(i).size() + old_bb_id(i->getParent()).size();
+            }
+        }
+    });
+    double t_new = seconds([&]() {
+        for (uint32_t round = 0; round < 2; round++) {
+            for (auto *i : insts) {
+                diff -= sar.getInstStrID(i).size() + sar.getBBStrID(i->getParent()).size();
+            }
+        }
+    });
+    double t_back = seconds([&]() {
+        for (auto *i : insts) {
+            auto *b = i->getParent();
+            auto *rb = dm->Modules->Numbering.getBasicBlock(b->getParent(), dm->Modules->Numbering.getOrdinal(b));
+            diff += rb != b || dm->Modules->Numbering.getInstruction(rb, dm->Modules->Numbering.getOrdinal(i)) != i;
+        }
+    });
+    for (auto *i : insts) {
+        diff += old_inst_id(i) != sar.getInstStrID(i) || old_bb_id(i->getParent()) != sar.getBBStrID(i->getParent());
+    }
+    std::cout << "instruction : " << insts.size() << std::endl;
+    std::cout << "memoized walk : " << t_old << " s" << std::endl;
+    std::cout << "numbering : " << t_new << " s" << std::endl;
+    std::cout << "ordinal to value : " << t_back << " s" << std::endl;
+    std::cout << "different : " << diff << std::endl;
+    return diff;
+}
+
+// the old grouping: every round takes the first remaining tag and compares it with all the remaining tags
+std::set<std::set<ID_TY>> old_tag_groups(TAG_INFO_TY &tag_info) {
+    auto same = [&](ID_TY t0, ID_TY t1) {
+        auto &inf0 = tag_info[t0];
+        auto &inf1 = tag_info[t1];
+        return inf0["v"] == inf1["v"] && inf0["vid"] == inf1["vid"] && inf0["field"] == inf1["field"] &&
+               inf0["is_global"] == inf1["is_global"] && inf0["ty"] == inf1["ty"];
+    };
+    std::set<std::set<ID_TY>> groups;
+    std::set<ID_TY> tags;
+    for (auto &x : tag_info) {
+        tags.insert(x.first);
+    }
+    while (!tags.empty()) {
+        ID_TY tgt = *(tags.begin());
+        std::set<ID_TY> group, temp;
+        for (auto t : tags) {
+            if (same(tgt, t)) {
+                group.insert(t);
+            } else {
+                temp.insert(t);
+            }
+        }
+        tags.swap(temp);
+        groups.insert(group);
+    }
+    return groups;
+}
+
+// grouping of the same typed tags and the lookup of the group of every tag, the old scans against the new index
+uint64_t bench_tags() {
+    auto *dm = new dra::DataManagement();
+    dm->initializeModule(obj_dump, assembly, bit_code);
+    TAINT_INFO info;
+    const uint64_t number_tag = 10000;
+    for (uint64_t t = 1; t <= number_tag; t++) {
+        auto &tag = info.tagInfo[t];
+        tag["is_global"] = t % 5 == 0 ? "false" : "true";
+        tag["ty"] = "i" + std::to_string(8 << (t % 4));
+        tag["field"] = std::to_string(t % 7);
+        tag["v"] = "@global_" + std::to_string(t % 300);
+        tag["vid"] = std::to_string(t % 300);
+    }
+    TaintTemp file(info);
+    auto *sar = new sta::StaticAnalysisResult();
+    double t_new = seconds([&]() { sar->initStaticRes(file.path, dm); });
+
+    std::set<std::set<ID_TY>> old_groups;
+    double t_old = seconds([&]() { old_groups = old_tag_groups(info.tagInfo); });
+    uint64_t found = 0;
+    double t_old_lookup = seconds([&]() {
+        for (auto &x : info.tagInfo) {
+            for (auto &g : old_groups) {
+                if (g.find(x.first) != g.end()) {
+                    found += g.size();
+                    break;
+                }
+            }
+        }
+    });
+    double t_new_lookup = seconds([&]() {
+        for (auto &x : info.tagInfo) {
+            found -= sar->getSameTypedTags(x.first)->size();
+        }
+    });
+    uint64_t diff = found;
+    std::set<std::set<ID_TY>> new_groups;
+    for (auto &x : info.tagInfo) {
+        new_groups.insert(*sar->getSameTypedTags(x.first));
+    }
+    diff += new_groups != old_groups;
+
+    std::cout << "tag : " << number_tag << " group : " << old_groups.size() << std::endl;
+    std::cout << "quadratic grouping : " << t_old << " s" << std::endl;
+    std::cout << "load with hashed grouping : " << t_new << " s" << std::endl;
+    std::cout << "group lookup by scan : " << t_old_lookup << " s" << std::endl;
+    std::cout << "group lookup by index : " << t_new_lookup << " s" << std::endl;
+    std::cout << "different : " << diff << std::endl;
+    return diff;
+}
+
+// the callees within distance 2 of the names of the branch functions, the old scan of all callees against the index
+uint64_t bench_callees() {
+    std::mt19937_64 random(1);
+    auto mutate = [&](std::string s) {
+        uint32_t edits = random() % 3;
+        for (uint32_t e = 0; e < edits && !s.empty(); e++) {
+            uint64_t p = random() % s.size();
+            switch (random() % 4) {
+                case 0: {
+                    s[p] = 'a' + random() % 26;
+                    break;
+                }
+                case 1: {
+                    s.insert(s.begin() + p, 'a' + random() % 26);
+                    break;
+                }
+                case 2: {
+                    s.erase(p, 1);
+                    break;
+                }
+                default: {
+                    if (p + 1 < s.size()) {
+                        std::swap(s[p], s[p + 1]);
+                    }
+                }
+            }
+        }
+        return s;
+    };
+
+    // the bounded kernel against the full matrix on short strings of a small alphabet
+    uint64_t diff = 0;
+    for (uint32_t k = 0; k < 200000; k++) {
+        std::string a, b;
+        for (uint64_t l = random() % 9; l > 0; l--) {
+            a.push_back('a' + random() % 3);
+        }
+        for (uint64_t l = random() % 9; l > 0; l--) {
+            b.push_back('a' + random() % 3);
+        }
+        int bound = random() % 4;
+        diff += std::min(sta::StaticAnalysisResult::levDistance(a, b), bound + 1) !=
+                sta::StaticAnalysisResult::levDistance(a, b, bound);
+    }
+
+    auto *dm = new dra::DataManagement();
+    dm->initializeModule(obj_dump, assembly, bit_code);
+    TAINT_INFO info;
+    std::vector<std::string> names;
+    for (auto *f : dm->Modules->AllFunction) {
+        names.push_back(f->FunctionName);
+    }
+    for (uint32_t k = 0; k < 20000 && !names.empty(); k++) {
+        info.calleeMap[mutate(names[random() % names.size()])];
+    }
+    std::vector<std::string> queries;
+    for (uint32_t k = 0; k < 2000 && !names.empty(); k++) {
+        queries.push_back(mutate(names[random() % names.size()]));
+    }
+    TaintTemp file(info);
+    auto *sar = new sta::StaticAnalysisResult();
+    sar->initStaticRes(file.path, dm);
+
+    std::vector<std::vector<std::string>> before(queries.size()), after(queries.size());
+    double t_scan = seconds([&]() {
+        for (uint64_t q = 0; q < queries.size(); q++) {
+            for (auto &x : info.calleeMap) {
+                int dis = sta::StaticAnalysisResult::levDistance(queries[q], x.first);
+                if (dis == 0 || dis > 2) {
+                    continue;
+                }
+                before[q].push_back(x.first);
+            }
+        }
+    });
+    uint64_t number_match = 0;
+    double t_index = seconds([&]() {
+        std::vector<CALLEE_MAP_TY::value_type *> res;
+        for (uint64_t q = 0; q < queries.size(); q++) {
+            sar->getSimilarCallees(queries[q], 2, res);
+            for (auto *x : res) {
+                after[q].push_back(x->first);
+            }
+            number_match += res.size();
+        }
+    });
+    diff += before != after;
+
+    std::cout << "callee : " << info.calleeMap.size() << " query : " << queries.size() << " match : "
+              << number_match << std::endl;
+    std::cout << "scan with full matrix : " << t_scan << " s" << std::endl;
+    std::cout << "length buckets with bounded kernel : " << t_index << " s" << std::endl;
+    std::cout << "different : " << diff << std::endl;
+    return diff;
+}
+
+// repeated rounds of queries for both successors of all tainted branches, resolving the mods per query and with the pool
+uint64_t bench_mods() {
+    TaintFixture fixture;
+    auto &branches = fixture.branches;
+    auto *sar = fixture.load();
+
+    typedef std::vector<std::tuple<llvm::BasicBlock *, llvm::Instruction *, int, int64_t, bool>> RESULT;
+    auto query = [&](std::vector<RESULT> &res) {
+        res.clear();
+        for (auto *b : branches) {
+            for (unsigned idx = 0; idx < 2; idx++) {
+                res.emplace_back();
+                sta::MODS *mods = sar->GetAllGlobalWriteBBs(b, idx);
+                if (mods == nullptr) {
+                    continue;
+                }
+                for (auto *m : *mods) {
+                    res.back().emplace_back(m->B, m->I, m->prio, m->repeat, m->from_nlp);
+                }
+                sta::StaticAnalysisResult::releaseMods(mods);
+            }
+        }
+    };
+    const int rounds = 3;
+    auto measure = [&](const char *name, std::vector<RESULT> &res) {
+        for (int r = 0; r < rounds; r++) {
+            double before = resident();
+            double t = seconds([&]() { query(res); });
+            std::cout << name << " round " << r << " : " << t << " s, " << res.size() / t << " queries/s, RSS +"
+                      << resident() - before << " MB" << std::endl;
+        }
+    };
+    std::vector<RESULT> before, after;
+    // the successors and dominator trees are cached by the first round
+    sar->useModPool = false;
+    query(before);
+    measure("resolved per query", before);
+    sar->useModPool = true;
+    measure("pool", after);
+
+    uint64_t number_mod = 0;
+    for (auto &r : after) {
+        number_mod += r.size();
+    }
+    std::cout << "query : " << after.size() << " mod : " << number_mod << std::endl;
+    std::cout << "different : " << (before != after) << std::endl;
+    return before != after;
+}
+
+// the queries for both successors of all tainted branches, one by one and as a batch on the worker threads
+uint64_t bench_batch() {
+    TaintFixture fixture;
+
+    std::vector<std::pair<llvm::BasicBlock *, unsigned int>> queries;
+    for (auto *b : fixture.branches) {
+        queries.emplace_back(b, 0);
+        queries.emplace_back(b, 1);
+    }
+    typedef std::vector<std::tuple<llvm::BasicBlock *, llvm::Instruction *, int, int64_t, bool>> RESULT;
+    auto collect = [](std::vector<sta::MODS *> &mods, std::vector<RESULT> &res) {
+        res.clear();
+        for (auto *m : mods) {
+            res.emplace_back();
+            if (m == nullptr) {
+                continue;
+            }
+            for (auto *x : *m) {
+                res.back().emplace_back(x->B, x->I, x->prio, x->repeat, x->from_nlp);
+            }
+            sta::StaticAnalysisResult::releaseMods(m);
+        }
+    };
+    // a fresh result for every run, so that each one starts without the successors, dominator trees and pool
+    auto run = [&](uint32_t t, std::vector<RESULT> &res) {
+        auto *sar = fixture.load();
+        std::vector<sta::MODS *> mods;
+        double s = seconds([&]() { mods = sar->GetAllGlobalWriteBBs(queries, t); });
+        collect(mods, res);
+        return s;
+    };
+    uint32_t t = thread == 0 ? dra::number_thread() : (uint32_t) thread;
+    std::vector<RESULT> serial, batch;
+    double t_serial = run(1, serial);
+    double t_batch = run(t, batch);
+
+    std::cout << "query : " << queries.size() << " thread : " << t << std::endl;
+    std::cout << "one by one : " << t_serial << " s, " << queries.size() / t_serial << " queries/s" << std::endl;
+    std::cout << "batch : " << t_batch << " s, " << queries.size() / t_batch << " queries/s" << std::endl;
+    std::cout << "different : " << (serial != batch) << std::endl;
+    return serial != batch;
+}
+
+// many dominance queries per function, by two concurrent batches on one result, against one thread
+uint64_t bench_dom() {
+    TaintFixture fixture;
+
+    // each function answers far more than the 32 slow queries after which an unnumbered tree renumbers itself
+    const uint32_t round = 64;
+    std::vector<std::pair<llvm::BasicBlock *, unsigned int>> queries;
+    for (uint32_t r = 0; r < round; r++) {
+        for (auto *b : fixture.branches) {
+            queries.emplace_back(b, 0);
+            queries.emplace_back(b, 1);
+        }
+    }
+    typedef std::vector<std::pair<llvm::BasicBlock *, llvm::Instruction *>> RESULT;
+    auto query = [&](sta::StaticAnalysisResult *sar, uint32_t t, std::vector<RESULT> &res) {
+        std::vector<sta::MODS *> mods = sar->GetAllGlobalWriteBBs(queries, t);
+        res.clear();
+        for (auto *m : mods) {
+            res.emplace_back();
+            if (m == nullptr) {
+                continue;
+            }
+            for (auto *x : *m) {
+                res.back().emplace_back(x->B, x->I);
+            }
+            sta::StaticAnalysisResult::releaseMods(m);
+        }
+    };
+    uint32_t t = thread == 0 ? dra::number_thread() : (uint32_t) thread;
+    std::vector<RESULT> serial, first, second;
+    auto *sar = fixture.load();
+    // every query runs filterMods and so dominates, instead of reading the pool
+    sar->useModPool = false;
+    double t_serial = seconds([&]() { query(sar, 1, serial); });
+    delete sar;
+
+    sar = fixture.load();
+    sar->useModPool = false;
+    double t_batch = seconds([&]() {
+        std::thread other([&]() { query(sar, t, second); });
+        query(sar, t, first);
+        other.join();
+    });
+    delete sar;
+
+    uint64_t different = (serial != first) + (serial != second);
+    std::cout << "query : " << queries.size() << " thread : " << t << std::endl;
+    std::cout << "one thread : " << t_serial << " s" << std::endl;
+    std::cout << "two batches : " << t_batch << " s" << std::endl;
+    std::cout << "different : " << different << std::endl;
+    return different;
+}
+
+// the old successor sets: a recursive walk, memoized per root BB in a map of sets
+void old_all_successors(std::map<llvm::BasicBlock *, std::set<llvm::BasicBlock *>> &succ_map, llvm::BasicBlock *bb,
+                        std::set<llvm::BasicBlock *> &res) {
+    if (!bb || res.find(bb) != res.end()) {
+        return;
+    }
+    if (succ_map.find(bb) != succ_map.end()) {
+        res.insert(succ_map[bb].begin(), succ_map[bb].end());
+        return;
+    }
+    res.insert(bb);
+    for (llvm::succ_iterator sit = llvm::succ_begin(bb), set = llvm::succ_end(bb); sit != set; ++sit) {
+        old_all_successors(succ_map, *sit, res);
+    }
+}
+
+void old_branch_succs(std::map<llvm::BasicBlock *, std::set<llvm::BasicBlock *>> &succ_map, llvm::BranchInst *br,
+                      unsigned idx, std::set<llvm::BasicBlock *> &res) {
+    std::set<llvm::BasicBlock *> succ_this, succ_other;
+    for (unsigned i = 0; i < br->getNumSuccessors(); ++i) {
+        llvm::BasicBlock *succ_bb = br->getSuccessor(i);
+        if (succ_map.find(succ_bb) == succ_map.end()) {
+            std::set<llvm::BasicBlock *> all;
+            old_all_successors(succ_map, succ_bb, all);
+            succ_map[succ_bb] = all;
+        }
+        auto &succs = succ_map[succ_bb];
+        (i == idx ? succ_this : succ_other).insert(succs.begin(), succs.end());
+    }
+    std::set_difference(succ_this.begin(), succ_this.end(), succ_other.begin(), succ_other.end(),
+                        std::inserter(res, res.end()));
+}
+
+// the BBs only reachable through each successor of every conditional branch, by sets and by bit vectors
+uint64_t bench_reach() {
+    auto *dm = new dra::DataManagement();
+    dm->initializeModule(obj_dump, assembly, bit_code);
+    std::vector<llvm::BranchInst *> branches;
+    for (auto *f : dm->Modules->AllFunction) {
+        if (f->isRepeat() || !f->isIR() || f->function == nullptr) {
+            continue;
+        }
+        f->materialize();
+        for (auto &b : *f->function) {
+            auto *br = llvm::dyn_cast<llvm::BranchInst>(b.getTerminator());
+            if (br != nullptr && br->isConditional()) {
+                branches.push_back(br);
+            }
+        }
+    }
+
+    std::vector<std::set<llvm::BasicBlock *>> before, after;
+    std::map<llvm::BasicBlock *, std::set<llvm::BasicBlock *>> succ_map;
+    double rss = resident();
+    double t_before = seconds([&]() {
+        for (auto *br : branches) {
+            for (unsigned idx = 0; idx < 2; idx++) {
+                before.emplace_back();
+                old_branch_succs(succ_map, br, idx, before.back());
+            }
+        }
+    });
+    double rss_before = resident() - rss;
+
+    sta::StaticAnalysisResult sar;
+    sar.dm = dm;
+    uint64_t number_bit = 0;
+    rss = resident();
+    double t_after = seconds([&]() {
+        llvm::BitVector bits;
+        for (auto *br : branches) {
+            for (unsigned idx = 0; idx < 2; idx++) {
+                after.emplace_back();
+                auto *reach = sar.getBranchSuccs(br, idx, bits);
+                if (reach == nullptr) {
+                    continue;
+                }
+                number_bit += bits.count();
+                for (int k = bits.find_first(); k >= 0; k = bits.find_next(k)) {
+                    after.back().insert(reach->Blocks[k]);
+                }
+            }
+        }
+    });
+    double rss_after = resident() - rss;
+
+    std::cout << "branch : " << branches.size() << " successor : " << number_bit << std::endl;
+    std::cout << "sets : " << t_before << " s, RSS +" << rss_before << " MB" << std::endl;
+    std::cout << "bit vectors : " << t_after << " s, RSS +" << rss_after << " MB (with the sets of the results)"
+              << std::endl;
+    std::cout << "different : " << (before != after) << std::endl;
+    return before != after;
+}
+
+// the queries for both successors of all tainted branches, live and from the precomputed write table
+uint64_t bench_table() {
+    TaintFixture fixture;
+    auto &branches = fixture.branches;
+    std::string table = fixture.file->path + ".writes";
+
+    // the position of the branch stands for its trace_pc address
+    std::vector<std::pair<llvm::BasicBlock *, unsigned int>> queries;
+    std::vector<uint64_t> addresses;
+    for (uint64_t i = 0; i < branches.size(); i++) {
+        for (unsigned int idx = 0; idx < 2; idx++) {
+            queries.emplace_back(branches[i], idx);
+            addresses.push_back(i);
+        }
+    }
+    typedef std::vector<std::tuple<llvm::BasicBlock *, llvm::Instruction *, int, int64_t, bool>> RESULT;
+    auto collect = [](sta::MODS *m, std::vector<RESULT> &res) {
+        res.emplace_back();
+        if (m == nullptr) {
+            return;
+        }
+        for (auto *x : *m) {
+            res.back().emplace_back(x->B, x->I, x->prio, x->repeat, x->from_nlp);
+        }
+        sta::StaticAnalysisResult::releaseMods(m);
+    };
+    uint32_t t = thread == 0 ? dra::number_thread() : (uint32_t) thread;
+    const uint64_t key[2] = {1, 2};
+
+    std::vector<RESULT> live, loaded;
+    double t_precompute = seconds([&]() {
+        std::unique_ptr<sta::StaticAnalysisResult> sar(fixture.load());
+        std::vector<sta::MODS *> mods = sar->GetAllGlobalWriteBBs(queries, t);
+        sar->writeWriteTable(table, key, addresses, queries, mods);
+        for (auto *m : mods) {
+            collect(m, live);
+        }
+    });
+
+    // a fresh result for each, so that neither finds the pool of the other
+    auto *cold = fixture.load();
+    std::vector<RESULT> again;
+    double t_live = seconds([&]() {
+        for (auto &q : queries) {
+            collect(cold->GetAllGlobalWriteBBs(q.first, q.second), again);
+        }
+    });
+    auto *sar = fixture.load();
+    bool opened = false;
+    double t_open = seconds([&]() { opened = sar->loadWriteTable(table, key); });
+    uint64_t missing = 0;
+    double t_table = seconds([&]() {
+        for (uint64_t i = 0; i < queries.size(); i++) {
+            bool found = false;
+            collect(sar->lookupWriteBBs(addresses[i], queries[i].second, &found), loaded);
+            missing += !found;
+        }
+    });
+    std::remove(table.c_str());
+
+    std::cout << "query : " << queries.size() << " thread : " << t << std::endl;
+    std::cout << "precompute : " << t_precompute << " s" << std::endl;
+    std::cout << "live : " << t_live << " s, " << queries.size() / t_live << " queries/s" << std::endl;
+    std::cout << "table : open " << opened << " " << t_open << " s, lookup " << t_table << " s, "
+              << queries.size() / t_table << " queries/s, missing " << missing << std::endl;
+    uint64_t diff = !opened || missing != 0 || live != loaded || again != loaded;
+    std::cout << "different : " << diff << std::endl;
+    return diff;
+}
+
+// the static analysis results of several devices, one after another and with the tables read in parallel
+uint64_t bench_devices() {
+    TaintFixture fixture;
+    auto *dm = fixture.dm;
+    const uint32_t number_device = 8;
+    // a file of its own for every device, as each device has its own taint_info
+    std::vector<std::unique_ptr<TaintTemp>> files;
+    std::vector<std::string> paths;
+    for (uint32_t i = 0; i < number_device; i++) {
+        files.emplace_back(new TaintTemp(fixture.info, i + 1));
+        paths.push_back(files.back()->path);
+    }
+    uint32_t t = thread == 0 ? dra::number_thread() : (uint32_t) thread;
+
+    std::vector<sta::StaticAnalysisResult *> serial(number_device), parallel(number_device);
+    double t_serial = seconds([&]() {
+        for (uint32_t i = 0; i < number_device; i++) {
+            serial[i] = new sta::StaticAnalysisResult();
+            serial[i]->initStaticRes(paths[i], dm);
+        }
+    });
+    double t_read = 0;
+    double t_parallel = seconds([&]() {
+        t_read = seconds([&]() {
+            dra::parallel_for(number_device, t, [&](uint64_t i) {
+                parallel[i] = new sta::StaticAnalysisResult();
+                parallel[i]->readStaticRes(paths[i], dm, 1);
+            });
+        });
+        for (auto *sar : parallel) {
+            sar->buildLocationIndex();
+        }
+    });
+    bool different = false;
+    for (uint32_t i = 0; i < number_device; i++) {
+        for (auto *b : fixture.branches) {
+            different |= serial[i]->getArgTaintStatus(b) != parallel[i]->getArgTaintStatus(b);
+        }
+        delete serial[i];
+        delete parallel[i];
+    }
+
+    std::cout << "device : " << number_device << " thread : " << t << std::endl;
+    std::cout << "one after another : " << t_serial << " s" << std::endl;
+    std::cout << "parallel : " << t_parallel << " s, of which reading " << t_read << " s" << std::endl;
+    std::cout << "different : " << different << std::endl;
+    return different;
+}
+
+int main(int argc, char **argv) {
+    llvm::sys::PrintStackTraceOnErrorSignal(argv[0]);
+    llvm::cl::ParseCommandLineOptions(argc, argv, "bench\n");
+
+    uint64_t diff;
+    if (mode == "objdump") {
+        diff = bench_objdump();
+    } else if (mode == "asm") {
+        diff = bench_asm();
+    } else if (mode == "snapshot") {
+        diff = bench_snapshot();
+    } else if (mode == "lazy") {
+        diff = bench_lazy();
+    } else if (mode == "address") {
+        diff = bench_address();
+    } else if (mode == "taint") {
+        diff = bench_taint();
+    } else if (mode == "sta") {
+        diff = bench_sta();
+    } else if (mode == "ids") {
+        diff = bench_ids();
+    } else if (mode == "tags") {
+        diff = bench_tags();
+    } else if (mode == "callees") {
+        diff = bench_callees();
+    } else if (mode == "mods") {
+        diff = bench_mods();
+    } else if (mode == "batch") {
+        diff = bench_batch();
+    } else if (mode == "dom") {
+        diff = bench_dom();
+    } else if (mode == "reach") {
+        diff = bench_reach();
+    } else if (mode == "table") {
+        diff = bench_table();
+    } else if (mode == "devices") {
+        diff = bench_devices();
+    } else {
+        std::cerr << "unknown benchmark : " << mode << std::endl;
+        return 1;
+    }
+    // any difference to the old implementation fails the run, so that the modes serve as regression checks
+    return diff == 0 ? 0 : 2;
+}
@@ -17,6 +17,23 @@ llvm::cl::opt<std::string> obj_dump("objdump", llvm::cl::desc("The obj dump file
                                     llvm::cl::init("./vmlinux.objdump"));
 llvm::cl::opt<std::string> assembly("asm", llvm::cl::desc("The assembly source code."), llvm::cl::init("./built-in.s"));
 llvm::cl::opt<std::string> bit_code("bc", llvm::cl::desc("The bit code."), llvm::cl::init("./built-in.bc"));
+llvm::cl::opt<bool> snapshot("snapshot", llvm::cl::desc("Load and save the module snapshot next to the obj dump."),
+                             llvm::cl::init(true));
+llvm::cl::opt<bool> lazy("lazy", llvm::cl::desc("Load the function bodies of the bit code on first use, needs the snapshot."),
+                         llvm::cl::init(false));
+llvm::cl::opt<bool> lazy_sta("lazy-sta", llvm::cl::desc("Load the static analysis result of a device on its first query."),
+                             llvm::cl::init(false));
+llvm::cl::opt<unsigned> max_sta("max-sta",
+                                llvm::cl::desc("The most static analysis results kept loaded with -lazy-sta, the least recently used are freed, 0 means no limit."),
+                                llvm::cl::init(0));
+llvm::cl::opt<unsigned> workers("workers",
+                                llvm::cl::desc("The threads analyzing the streamed inputs, 0 means one per core."),
+                                llvm::cl::init(0));
+llvm::cl::opt<unsigned> queue("queue", llvm::cl::desc("The most inputs queued between two stages of the analysis."),
+                              llvm::cl::init(64));
+llvm::cl::opt<bool> precompute("precompute",
+                               llvm::cl::desc("Write the static analysis results of all the conditions next to the taint_info files and exit."),
+                               llvm::cl::init(false));
 
 llvm::cl::opt<std::string> port("port", llvm::cl::desc("The port of grpc."), llvm::cl::init("127.0.0.1:22223"));
 llvm::cl::opt<std::string> config(llvm::cl::Positional, llvm::cl::desc("The dra config file"), llvm::cl::init("dra.json"));
@@ -34,7 +51,16 @@ int main(int argc, char **argv)
 #endif
 
     auto *dcc = new dra::DependencyControlCenter();
+    dcc->setSnapshot(snapshot);
+    dcc->setLazy(lazy);
+    dcc->setLazySTA(lazy_sta, max_sta);
+    dcc->setPipeline(workers, queue);
 
+    if (precompute) {
+        dcc->init(obj_dump, assembly, bit_code, config);
+        dcc->precompute_write_basicblock();
+        return 0;
+    }
     dcc->init(obj_dump, assembly, bit_code, config, port);
 //    dcc->test();
     dcc->run();
@@ -0,0 +1,192 @@
+/*
+ * feed.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *  a local stand-in of the DependencyRPC server of syz-manager for dra:
+ *  it offers the inputs of the given files one by one, by StreamNewInput or GetNewInput,
+ *  and prints how long dra takes from an input to its first dependency, by SendDependencies or SendDependency.
+ */
+#include <llvm/Support/Signals.h>
+#include <llvm/Support/CommandLine.h>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <grpcpp/grpcpp.h>
+
+#include "../../lib/RPC/DependencyRPC.grpc.pb.h"
+
+llvm::cl::list<std::string> inputs(llvm::cl::Positional, llvm::cl::desc("<file of a serialized Inputs>..."),
+                                   llvm::cl::OneOrMore);
+llvm::cl::opt<std::string> port("port", llvm::cl::desc("The port of grpc."), llvm::cl::init("127.0.0.1:22223"));
+llvm::cl::opt<unsigned> offset("offset", llvm::cl::desc("The vm offset sent to dra by GetVMOffsets."),
+                               llvm::cl::init(0));
+llvm::cl::opt<unsigned> interval("interval", llvm::cl::desc("The milliseconds between two inputs."),
+                                 llvm::cl::init(1000));
+llvm::cl::opt<bool> stream("stream", llvm::cl::desc("Serve StreamNewInput, StreamCondition and SendDependencies, "
+                                                   "otherwise dra polls and sends the dependencies one by one."),
+                           llvm::cl::init(true));
+
+class Feed final : public dra::DependencyRPC::Service {
+public:
+    void offer(const dra::Input &input) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->pending.push_back(input);
+        this->offered[input.sig()] = std::chrono::steady_clock::now();
+        this->ready.notify_all();
+    }
+
+    grpc::Status GetVMOffsets(grpc::ServerContext *, const dra::Empty *, dra::Empty *response) override {
+        response->set_address(offset);
+        return grpc::Status::OK;
+    }
+
+    grpc::Status SendNumberBasicBlock(grpc::ServerContext *, const dra::Empty *request, dra::Empty *) override {
+        std::cout << "NumberBasicBlock : " << request->address() << std::endl;
+        return grpc::Status::OK;
+    }
+
+    grpc::Status SendNumberBasicBlockCovered(grpc::ServerContext *, const dra::Empty *request, dra::Empty *) override {
+        std::cout << "NumberBasicBlockCovered : " << request->address() << std::endl;
+        return grpc::Status::OK;
+    }
+
+    grpc::Status GetNewInput(grpc::ServerContext *, const dra::Empty *, dra::Inputs *response) override {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (!this->pending.empty()) {
+            *response->add_input() = this->pending.front();
+            this->pending.pop_front();
+        }
+        return grpc::Status::OK;
+    }
+
+    grpc::Status SendDependency(grpc::ServerContext *, const dra::Dependency *request, dra::Empty *) override {
+        this->arrive(*request);
+        return grpc::Status::OK;
+    }
+
+    grpc::Status SendDependencies(grpc::ServerContext *, grpc::ServerReader<dra::Dependency> *reader,
+                                  dra::Empty *) override {
+        if (!stream) {
+            return {grpc::StatusCode::UNIMPLEMENTED, ""};
+        }
+        dra::Dependency request;
+        uint64_t count = 0;
+        while (reader->Read(&request)) {
+            this->arrive(request);
+            count++;
+        }
+        std::cout << "stream of " << count << " dependencies" << std::endl;
+        return grpc::Status::OK;
+    }
+
+    grpc::Status GetCondition(grpc::ServerContext *, const dra::Empty *, dra::Conditions *) override {
+        return grpc::Status::OK;
+    }
+
+    grpc::Status SendWriteAddress(grpc::ServerContext *, const dra::WriteAddresses *, dra::Empty *) override {
+        return grpc::Status::OK;
+    }
+
+    grpc::Status StreamNewInput(grpc::ServerContext *context, const dra::Empty *,
+                                grpc::ServerWriter<dra::Inputs> *writer) override {
+        if (!stream) {
+            return {grpc::StatusCode::UNIMPLEMENTED, ""};
+        }
+        std::unique_lock<std::mutex> lock(this->mutex);
+        while (!context->IsCancelled()) {
+            if (this->pending.empty()) {
+                this->ready.wait_for(lock, std::chrono::seconds(1));
+                continue;
+            }
+            dra::Inputs reply;
+            *reply.add_input() = this->pending.front();
+            this->pending.pop_front();
+            lock.unlock();
+            bool ok = writer->Write(reply);
+            lock.lock();
+            if (!ok) {
+                this->pending.push_front(reply.input(0));
+                break;
+            }
+        }
+        return grpc::Status::OK;
+    }
+
+    grpc::Status StreamCondition(grpc::ServerContext *context, const dra::Empty *,
+                                 grpc::ServerWriter<dra::Conditions> *) override {
+        if (!stream) {
+            return {grpc::StatusCode::UNIMPLEMENTED, ""};
+        }
+        //the conditions are never pushed, as syz-manager
+        while (!context->IsCancelled()) {
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+        }
+        return grpc::Status::OK;
+    }
+
+private:
+    void arrive(const dra::Dependency &request) {
+        if (!request.has_input()) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(this->mutex);
+        auto o = this->offered.find(request.input().sig());
+        if (o != this->offered.end()) {
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - o->second).count();
+            std::cout << "first dependency of " << o->first << " after " << ms << " ms" << std::endl;
+            this->offered.erase(o);
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<dra::Input> pending;
+    std::unordered_map<std::string, std::chrono::steady_clock::time_point> offered;
+};
+
+int main(int argc, char **argv) {
+    llvm::sys::PrintStackTraceOnErrorSignal(argv[0]);
+    llvm::cl::ParseCommandLineOptions(argc, argv, "feed\n");
+
+    std::vector<dra::Input> all;
+    for (const auto &file : inputs) {
+        std::ifstream input(file, std::ios::binary);
+        dra::Inputs in;
+        if (!input.is_open() || !in.ParseFromIstream(&input)) {
+            std::cerr << "Failed to read the inputs " << file << std::endl;
+            return 1;
+        }
+        for (const auto &i : in.input()) {
+            all.push_back(i);
+        }
+    }
+
+    Feed feed;
+    grpc::ServerBuilder builder;
+    builder.SetMaxReceiveMessageSize(-1);
+    builder.SetMaxSendMessageSize(-1);
+    builder.AddListeningPort(port, grpc::InsecureServerCredentials());
+    builder.RegisterService(&feed);
+    std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
+    if (server == nullptr) {
+        std::cerr << "Failed to listen on " << port << std::endl;
+        return 1;
+    }
+    std::cout << "feed " << all.size() << " inputs on " << port << std::endl;
+
+    for (const auto &i : all) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(interval));
+        feed.offer(i);
+        std::cout << "offer " << i.sig() << std::endl;
+    }
+    std::cout << "all the inputs are offered" << std::endl;
+    server->Wait();
+    return 0;
+}
@@ -0,0 +1,43 @@
+/*
+ * t2b.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *  compile the taint_info files of the static analysis into the binary form loaded by dra.
+ */
+#include <llvm/Support/Signals.h>
+#include <llvm/Support/CommandLine.h>
+#include <iostream>
+
+#include "../../lib/STA/TaintFile.h"
+
+llvm::cl::list<std::string> taint(llvm::cl::Positional, llvm::cl::desc("<taint_info file>..."),
+                                  llvm::cl::OneOrMore);
+llvm::cl::opt<std::string> output("o", llvm::cl::desc("The output file, only for one input, default <input>.bin."),
+                                  llvm::cl::init(""));
+
+int main(int argc, char **argv) {
+    llvm::sys::PrintStackTraceOnErrorSignal(argv[0]);
+    llvm::cl::ParseCommandLineOptions(argc, argv, "t2b\n");
+
+    if (!output.empty() && taint.size() != 1) {
+        std::cerr << "-o needs exactly one taint_info file" << std::endl;
+        return 1;
+    }
+    int res = 0;
+    for (const auto &input : taint) {
+        std::string out = output.empty() ? input + ".bin" : std::string(output);
+        TAINT_INFO info;
+        if (!sta::TaintFile::read(input, info)) {
+            std::cerr << "Fail to deserialize the static analysis results " << input << std::endl;
+            res = 1;
+            continue;
+        }
+        if (!sta::TaintFile::writeBinary(out, info)) {
+            res = 1;
+            continue;
+        }
+        std::cout << input << " -> " << out << std::endl;
+    }
+    return res;
+}
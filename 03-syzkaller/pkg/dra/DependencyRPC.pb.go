@@ -308,7 +308,7 @@ var file_DependencyRPC_proto_rawDesc = []byte{
 	0x73, 0x52, 0x08, 0x62, 0x6f, 0x6f, 0x74, 0x54, 0x61, 0x73, 0x6b, 0x12, 0x2b, 0x0a, 0x0b, 0x72,
 	0x65, 0x74, 0x75, 0x72, 0x6e, 0x5f, 0x62, 0x6f, 0x6f, 0x74, 0x18, 0x15, 0x20, 0x01, 0x28, 0x0b,
 	0x32, 0x0a, 0x2e, 0x64, 0x72, 0x61, 0x2e, 0x54, 0x61, 0x73, 0x6b, 0x73, 0x52, 0x0a, 0x72, 0x65,
-	0x74, 0x75, 0x72, 0x6e, 0x42, 0x6f, 0x6f, 0x74, 0x32, 0xe6, 0x06, 0x0a, 0x0d, 0x44, 0x65, 0x70,
+	0x74, 0x75, 0x72, 0x6e, 0x42, 0x6f, 0x6f, 0x74, 0x32, 0xfe, 0x07, 0x0a, 0x0d, 0x44, 0x65, 0x70,
 	0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x79, 0x52, 0x50, 0x43, 0x12, 0x28, 0x0a, 0x0c, 0x47, 0x65,
 	0x74, 0x56, 0x4d, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x73, 0x12, 0x0a, 0x2e, 0x64, 0x72, 0x61,
 	0x2e, 0x45, 0x6d, 0x70, 0x74, 0x79, 0x1a, 0x0a, 0x2e, 0x64, 0x72, 0x61, 0x2e, 0x45, 0x6d, 0x70,
@@ -363,8 +363,17 @@ var file_DependencyRPC_proto_rawDesc = []byte{
 	0x6d, 0x70, 0x74, 0x79, 0x22, 0x00, 0x12, 0x29, 0x0a, 0x0d, 0x53, 0x65, 0x6e, 0x64, 0x4e, 0x65,
 	0x65, 0x64, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x12, 0x0a, 0x2e, 0x64, 0x72, 0x61, 0x2e, 0x49, 0x6e,
 	0x70, 0x75, 0x74, 0x1a, 0x0a, 0x2e, 0x64, 0x72, 0x61, 0x2e, 0x45, 0x6d, 0x70, 0x74, 0x79, 0x22,
-	0x00, 0x42, 0x07, 0x5a, 0x05, 0x2e, 0x3b, 0x64, 0x72, 0x61, 0x62, 0x06, 0x70, 0x72, 0x6f, 0x74,
-	0x6f, 0x33,
+	0x00, 0x12, 0x2d, 0x0a, 0x0e, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4e, 0x65, 0x77, 0x49, 0x6e,
+	0x70, 0x75, 0x74, 0x12, 0x0a, 0x2e, 0x64, 0x72, 0x61, 0x2e, 0x45, 0x6d, 0x70, 0x74, 0x79, 0x1a,
+	0x0b, 0x2e, 0x64, 0x72, 0x61, 0x2e, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x22, 0x00, 0x30, 0x01,
+	0x12, 0x32, 0x0a, 0x0f, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x43, 0x6f, 0x6e, 0x64, 0x69, 0x74,
+	0x69, 0x6f, 0x6e, 0x12, 0x0a, 0x2e, 0x64, 0x72, 0x61, 0x2e, 0x45, 0x6d, 0x70, 0x74, 0x79, 0x1a,
+	0x0f, 0x2e, 0x64, 0x72, 0x61, 0x2e, 0x43, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73,
+	0x22, 0x00, 0x30, 0x01, 0x12, 0x33, 0x0a, 0x10, 0x53, 0x65, 0x6e, 0x64, 0x44, 0x65, 0x70, 0x65,
+	0x6e, 0x64, 0x65, 0x6e, 0x63, 0x69, 0x65, 0x73, 0x12, 0x0f, 0x2e, 0x64, 0x72, 0x61, 0x2e, 0x44,
+	0x65, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x6e, 0x63, 0x79, 0x1a, 0x0a, 0x2e, 0x64, 0x72, 0x61, 0x2e,
+	0x45, 0x6d, 0x70, 0x74, 0x79, 0x22, 0x00, 0x28, 0x01, 0x42, 0x07, 0x5a, 0x05, 0x2e, 0x3b, 0x64,
+	0x72, 0x61, 0x62, 0x06, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x33,
 }
 
 var (
@@ -440,27 +449,33 @@ var file_DependencyRPC_proto_depIdxs = []int32{
 	18, // 33: dra.DependencyRPC.sendStat:input_type -> dra.Statistic
 	14, // 34: dra.DependencyRPC.GetNeed:input_type -> dra.Empty
 	10, // 35: dra.DependencyRPC.SendNeedInput:input_type -> dra.Input
-	14, // 36: dra.DependencyRPC.GetVMOffsets:output_type -> dra.Empty
-	14, // 37: dra.DependencyRPC.SendNumberBasicBlock:output_type -> dra.Empty
-	14, // 38: dra.DependencyRPC.SendNumberBasicBlockCovered:output_type -> dra.Empty
-	19, // 39: dra.DependencyRPC.GetNewInput:output_type -> dra.Inputs
-	14, // 40: dra.DependencyRPC.SendDependency:output_type -> dra.Empty
-	20, // 41: dra.DependencyRPC.GetCondition:output_type -> dra.Conditions
-	14, // 42: dra.DependencyRPC.SendWriteAddress:output_type -> dra.Empty
-	14, // 43: dra.DependencyRPC.Connect:output_type -> dra.Empty
-	0,  // 44: dra.DependencyRPC.GetDataDependency:output_type -> dra.DataDependency
-	14, // 45: dra.DependencyRPC.SendNewInput:output_type -> dra.Empty
-	9,  // 46: dra.DependencyRPC.GetTasks:output_type -> dra.Tasks
-	9,  // 47: dra.DependencyRPC.GetBootTasks:output_type -> dra.Tasks
-	14, // 48: dra.DependencyRPC.ReturnTasks:output_type -> dra.Empty
-	14, // 49: dra.DependencyRPC.SendBootInput:output_type -> dra.Empty
-	14, // 50: dra.DependencyRPC.SendUnstableInput:output_type -> dra.Empty
-	14, // 51: dra.DependencyRPC.SendLog:output_type -> dra.Empty
-	14, // 52: dra.DependencyRPC.sendStat:output_type -> dra.Empty
-	14, // 53: dra.DependencyRPC.GetNeed:output_type -> dra.Empty
-	14, // 54: dra.DependencyRPC.SendNeedInput:output_type -> dra.Empty
-	36, // [36:55] is the sub-list for method output_type
-	17, // [17:36] is the sub-list for method input_type
+	14, // 36: dra.DependencyRPC.StreamNewInput:input_type -> dra.Empty
+	14, // 37: dra.DependencyRPC.StreamCondition:input_type -> dra.Empty
+	15, // 38: dra.DependencyRPC.SendDependencies:input_type -> dra.Dependency
+	14, // 39: dra.DependencyRPC.GetVMOffsets:output_type -> dra.Empty
+	14, // 40: dra.DependencyRPC.SendNumberBasicBlock:output_type -> dra.Empty
+	14, // 41: dra.DependencyRPC.SendNumberBasicBlockCovered:output_type -> dra.Empty
+	19, // 42: dra.DependencyRPC.GetNewInput:output_type -> dra.Inputs
+	14, // 43: dra.DependencyRPC.SendDependency:output_type -> dra.Empty
+	20, // 44: dra.DependencyRPC.GetCondition:output_type -> dra.Conditions
+	14, // 45: dra.DependencyRPC.SendWriteAddress:output_type -> dra.Empty
+	14, // 46: dra.DependencyRPC.Connect:output_type -> dra.Empty
+	0,  // 47: dra.DependencyRPC.GetDataDependency:output_type -> dra.DataDependency
+	14, // 48: dra.DependencyRPC.SendNewInput:output_type -> dra.Empty
+	9,  // 49: dra.DependencyRPC.GetTasks:output_type -> dra.Tasks
+	9,  // 50: dra.DependencyRPC.GetBootTasks:output_type -> dra.Tasks
+	14, // 51: dra.DependencyRPC.ReturnTasks:output_type -> dra.Empty
+	14, // 52: dra.DependencyRPC.SendBootInput:output_type -> dra.Empty
+	14, // 53: dra.DependencyRPC.SendUnstableInput:output_type -> dra.Empty
+	14, // 54: dra.DependencyRPC.SendLog:output_type -> dra.Empty
+	14, // 55: dra.DependencyRPC.sendStat:output_type -> dra.Empty
+	14, // 56: dra.DependencyRPC.GetNeed:output_type -> dra.Empty
+	14, // 57: dra.DependencyRPC.SendNeedInput:output_type -> dra.Empty
+	19, // 58: dra.DependencyRPC.StreamNewInput:output_type -> dra.Inputs
+	20, // 59: dra.DependencyRPC.StreamCondition:output_type -> dra.Conditions
+	14, // 60: dra.DependencyRPC.SendDependencies:output_type -> dra.Empty
+	39, // [39:61] is the sub-list for method output_type
+	17, // [17:39] is the sub-list for method input_type
 	17, // [17:17] is the sub-list for extension type_name
 	17, // [17:17] is the sub-list for extension extendee
 	0,  // [0:17] is the sub-list for field type_name
@@ -2,6 +2,7 @@ package dra
 
 import (
 	"context"
+	"io"
 	"net"
 	"os"
 	"sort"
@@ -63,6 +64,8 @@ type Server struct {
 	// inputs of new test cases, used to get DataDependency
 	newInputMu *sync.Mutex
 	newInput   *Inputs
+	// wakes StreamNewInput up when newInput gets an input
+	newInputSignal chan struct{}
 
 	// inputs picked by randomly, used as new test cases.
 	needInputMu *sync.Mutex
@@ -107,7 +110,33 @@ func (ss Server) GetVMOffsets(context.Context, *Empty) (*Empty, error) {
 // GetNewInput is to send new input ro dra
 func (ss Server) GetNewInput(context.Context, *Empty) (*Inputs, error) {
 	log.Logf(DebugLevel, "(ss Server) GetNewInput")
+	return ss.popNewInput(), nil
+}
 
+// StreamNewInput is to send new input to dra as soon as syz-fuzzer sends it, instead of dra polling GetNewInput
+func (ss Server) StreamNewInput(_ *Empty, stream DependencyRPC_StreamNewInputServer) error {
+	log.Logf(DebugLevel, "(ss Server) StreamNewInput")
+	for {
+		reply := ss.popNewInput()
+		if len(reply.Input) == 0 {
+			select {
+			case <-ss.newInputSignal:
+				continue
+			case <-stream.Context().Done():
+				return nil
+			}
+		}
+		if err := stream.Send(reply); err != nil {
+			// give the input back to GetNewInput or the next stream
+			ss.newInputMu.Lock()
+			ss.newInput.Input = append(ss.newInput.Input, reply.Input...)
+			ss.newInputMu.Unlock()
+			return err
+		}
+	}
+}
+
+func (ss Server) popNewInput() *Inputs {
 	reply := &Inputs{
 		Input: []*Input{},
 	}
@@ -132,7 +161,7 @@ func (ss Server) GetNewInput(context.Context, *Empty) (*Inputs, error) {
 		i.Paths = nil
 	}
 
-	return reply, nil
+	return reply
 }
 
 // SendDependency is to get depednency information from dra
@@ -149,6 +178,46 @@ func (ss Server) SendDependency(_ context.Context, request *Dependency) (*Empty,
 	return reply, nil
 }
 
+// SendDependencies is to get the dependencies of SendDependency from dra in one stream,
+// a chunk without input is merged into the dependency before it
+func (ss Server) SendDependencies(stream DependencyRPC_SendDependenciesServer) error {
+	log.Logf(DebugLevel, "(ss Server) SendDependencies")
+	var last *Dependency
+	push := func() {
+		if last != nil {
+			ss.dependencyMu.Lock()
+			ss.newDependency.newDependency = append(ss.newDependency.newDependency, last)
+			ss.dependencyMu.Unlock()
+			last = nil
+		}
+	}
+	for {
+		d, err := stream.Recv()
+		if err == io.EOF {
+			push()
+			return stream.SendAndClose(&Empty{})
+		}
+		if err != nil {
+			push()
+			return err
+		}
+
+		if d.Input == nil && last != nil &&
+			d.UncoveredAddress.GetUncoveredAddress() == last.UncoveredAddress.GetUncoveredAddress() {
+			last.WriteAddress = append(last.WriteAddress, d.WriteAddress...)
+			if last.UncoveredAddress.WriteAddress == nil {
+				last.UncoveredAddress.WriteAddress = map[uint32]*WriteAddressAttributes{}
+			}
+			for a, waa := range d.UncoveredAddress.GetWriteAddress() {
+				last.UncoveredAddress.WriteAddress[a] = waa
+			}
+			continue
+		}
+		push()
+		last = d
+	}
+}
+
 // GetCondition is to send condition to dra
 func (ss Server) GetCondition(context.Context, *Empty) (*Conditions, error) {
 	log.Logf(DebugLevel, "(ss Server) GetCondition")
@@ -160,6 +229,13 @@ func (ss Server) GetCondition(context.Context, *Empty) (*Conditions, error) {
 	return reply, nil
 }
 
+// StreamCondition is to send condition to dra as it appears, nothing is sent as GetCondition
+func (ss Server) StreamCondition(_ *Empty, stream DependencyRPC_StreamConditionServer) error {
+	log.Logf(DebugLevel, "(ss Server) StreamCondition")
+	<-stream.Context().Done()
+	return nil
+}
+
 // SendWriteAddress is to get write address for the condition from dra
 func (ss Server) SendWriteAddress(_ context.Context, _ *WriteAddresses) (*Empty, error) {
 	log.Logf(DebugLevel, "(ss Server) SendWriteAddress")
@@ -238,6 +314,10 @@ func (ss Server) SendNewInput(_ context.Context, request *Input) (*Empty, error)
 	log.Logf(DebugLevel, "(ss Server) SendNewInput len of newInput : %v", last)
 	log.Logf(DebugLevel, "(ss Server) SendNewInput newInput : %v", r)
 	ss.newInputMu.Unlock()
+	select {
+	case ss.newInputSignal <- struct{}{}:
+	default:
+	}
 
 	ss.coveredInputMu.Lock()
 	ss.coveredInput.Input = append(ss.coveredInput.Input, r)
@@ -451,6 +531,7 @@ func (ss *Server) RunDependencyRPCServer(corpus *map[string]rpctype.RPCInput) {
 
 	ss.newInputMu = &sync.Mutex{}
 	ss.newInput = &Inputs{Input: []*Input{}}
+	ss.newInputSignal = make(chan struct{}, 1)
 
 	ss.needInputMu = &sync.Mutex{}
 	ss.needInput = &Inputs{Input: []*Input{}}
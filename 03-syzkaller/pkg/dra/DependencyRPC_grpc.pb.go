@@ -39,6 +39,12 @@ type DependencyRPCClient interface {
 	SendStat(ctx context.Context, in *Statistic, opts ...grpc.CallOption) (*Empty, error)
 	GetNeed(ctx context.Context, in *Empty, opts ...grpc.CallOption) (*Empty, error)
 	SendNeedInput(ctx context.Context, in *Input, opts ...grpc.CallOption) (*Empty, error)
+	// DRA and syz-manager, pushed as they appear instead of polled by GetNewInput and GetCondition
+	StreamNewInput(ctx context.Context, in *Empty, opts ...grpc.CallOption) (DependencyRPC_StreamNewInputClient, error)
+	StreamCondition(ctx context.Context, in *Empty, opts ...grpc.CallOption) (DependencyRPC_StreamConditionClient, error)
+	// DRA and syz-manager, the dependencies of SendDependency in one stream, a big one split into chunks
+	// by its write addresses, the chunks after the first have no input
+	SendDependencies(ctx context.Context, opts ...grpc.CallOption) (DependencyRPC_SendDependenciesClient, error)
 }
 
 type dependencyRPCClient struct {
@@ -220,6 +226,104 @@ func (c *dependencyRPCClient) SendNeedInput(ctx context.Context, in *Input, opts
 	return out, nil
 }
 
+func (c *dependencyRPCClient) StreamNewInput(ctx context.Context, in *Empty, opts ...grpc.CallOption) (DependencyRPC_StreamNewInputClient, error) {
+	stream, err := c.cc.NewStream(ctx, &DependencyRPC_ServiceDesc.Streams[0], "/dra.DependencyRPC/StreamNewInput", opts...)
+	if err != nil {
+		return nil, err
+	}
+	x := &dependencyRPCStreamNewInputClient{stream}
+	if err := x.ClientStream.SendMsg(in); err != nil {
+		return nil, err
+	}
+	if err := x.ClientStream.CloseSend(); err != nil {
+		return nil, err
+	}
+	return x, nil
+}
+
+type DependencyRPC_StreamNewInputClient interface {
+	Recv() (*Inputs, error)
+	grpc.ClientStream
+}
+
+type dependencyRPCStreamNewInputClient struct {
+	grpc.ClientStream
+}
+
+func (x *dependencyRPCStreamNewInputClient) Recv() (*Inputs, error) {
+	m := new(Inputs)
+	if err := x.ClientStream.RecvMsg(m); err != nil {
+		return nil, err
+	}
+	return m, nil
+}
+
+func (c *dependencyRPCClient) StreamCondition(ctx context.Context, in *Empty, opts ...grpc.CallOption) (DependencyRPC_StreamConditionClient, error) {
+	stream, err := c.cc.NewStream(ctx, &DependencyRPC_ServiceDesc.Streams[1], "/dra.DependencyRPC/StreamCondition", opts...)
+	if err != nil {
+		return nil, err
+	}
+	x := &dependencyRPCStreamConditionClient{stream}
+	if err := x.ClientStream.SendMsg(in); err != nil {
+		return nil, err
+	}
+	if err := x.ClientStream.CloseSend(); err != nil {
+		return nil, err
+	}
+	return x, nil
+}
+
+type DependencyRPC_StreamConditionClient interface {
+	Recv() (*Conditions, error)
+	grpc.ClientStream
+}
+
+type dependencyRPCStreamConditionClient struct {
+	grpc.ClientStream
+}
+
+func (x *dependencyRPCStreamConditionClient) Recv() (*Conditions, error) {
+	m := new(Conditions)
+	if err := x.ClientStream.RecvMsg(m); err != nil {
+		return nil, err
+	}
+	return m, nil
+}
+
+func (c *dependencyRPCClient) SendDependencies(ctx context.Context, opts ...grpc.CallOption) (DependencyRPC_SendDependenciesClient, error) {
+	stream, err := c.cc.NewStream(ctx, &DependencyRPC_ServiceDesc.Streams[2], "/dra.DependencyRPC/SendDependencies", opts...)
+	if err != nil {
+		return nil, err
+	}
+	x := &dependencyRPCSendDependenciesClient{stream}
+	return x, nil
+}
+
+type DependencyRPC_SendDependenciesClient interface {
+	Send(*Dependency) error
+	CloseAndRecv() (*Empty, error)
+	grpc.ClientStream
+}
+
+type dependencyRPCSendDependenciesClient struct {
+	grpc.ClientStream
+}
+
+func (x *dependencyRPCSendDependenciesClient) Send(m *Dependency) error {
+	return x.ClientStream.SendMsg(m)
+}
+
+func (x *dependencyRPCSendDependenciesClient) CloseAndRecv() (*Empty, error) {
+	if err := x.ClientStream.CloseSend(); err != nil {
+		return nil, err
+	}
+	m := new(Empty)
+	if err := x.ClientStream.RecvMsg(m); err != nil {
+		return nil, err
+	}
+	return m, nil
+}
+
 // DependencyRPCServer is the server API for DependencyRPC service.
 // All implementations must embed UnimplementedDependencyRPCServer
 // for forward compatibility
@@ -245,6 +349,12 @@ type DependencyRPCServer interface {
 	SendStat(context.Context, *Statistic) (*Empty, error)
 	GetNeed(context.Context, *Empty) (*Empty, error)
 	SendNeedInput(context.Context, *Input) (*Empty, error)
+	// DRA and syz-manager, pushed as they appear instead of polled by GetNewInput and GetCondition
+	StreamNewInput(*Empty, DependencyRPC_StreamNewInputServer) error
+	StreamCondition(*Empty, DependencyRPC_StreamConditionServer) error
+	// DRA and syz-manager, the dependencies of SendDependency in one stream, a big one split into chunks
+	// by its write addresses, the chunks after the first have no input
+	SendDependencies(DependencyRPC_SendDependenciesServer) error
 	mustEmbedUnimplementedDependencyRPCServer()
 }
 
@@ -309,6 +419,15 @@ func (UnimplementedDependencyRPCServer) GetNeed(context.Context, *Empty) (*Empty
 func (UnimplementedDependencyRPCServer) SendNeedInput(context.Context, *Input) (*Empty, error) {
 	return nil, status.Errorf(codes.Unimplemented, "method SendNeedInput not implemented")
 }
+func (UnimplementedDependencyRPCServer) StreamNewInput(*Empty, DependencyRPC_StreamNewInputServer) error {
+	return status.Errorf(codes.Unimplemented, "method StreamNewInput not implemented")
+}
+func (UnimplementedDependencyRPCServer) StreamCondition(*Empty, DependencyRPC_StreamConditionServer) error {
+	return status.Errorf(codes.Unimplemented, "method StreamCondition not implemented")
+}
+func (UnimplementedDependencyRPCServer) SendDependencies(DependencyRPC_SendDependenciesServer) error {
+	return status.Errorf(codes.Unimplemented, "method SendDependencies not implemented")
+}
 func (UnimplementedDependencyRPCServer) mustEmbedUnimplementedDependencyRPCServer() {}
 
 // UnsafeDependencyRPCServer may be embedded to opt out of forward compatibility for this service.
@@ -664,6 +783,74 @@ func _DependencyRPC_SendNeedInput_Handler(srv interface{}, ctx context.Context,
 	return interceptor(ctx, in, info, handler)
 }
 
+func _DependencyRPC_StreamNewInput_Handler(srv interface{}, stream grpc.ServerStream) error {
+	m := new(Empty)
+	if err := stream.RecvMsg(m); err != nil {
+		return err
+	}
+	return srv.(DependencyRPCServer).StreamNewInput(m, &dependencyRPCStreamNewInputServer{stream})
+}
+
+type DependencyRPC_StreamNewInputServer interface {
+	Send(*Inputs) error
+	grpc.ServerStream
+}
+
+type dependencyRPCStreamNewInputServer struct {
+	grpc.ServerStream
+}
+
+func (x *dependencyRPCStreamNewInputServer) Send(m *Inputs) error {
+	return x.ServerStream.SendMsg(m)
+}
+
+func _DependencyRPC_StreamCondition_Handler(srv interface{}, stream grpc.ServerStream) error {
+	m := new(Empty)
+	if err := stream.RecvMsg(m); err != nil {
+		return err
+	}
+	return srv.(DependencyRPCServer).StreamCondition(m, &dependencyRPCStreamConditionServer{stream})
+}
+
+type DependencyRPC_StreamConditionServer interface {
+	Send(*Conditions) error
+	grpc.ServerStream
+}
+
+type dependencyRPCStreamConditionServer struct {
+	grpc.ServerStream
+}
+
+func (x *dependencyRPCStreamConditionServer) Send(m *Conditions) error {
+	return x.ServerStream.SendMsg(m)
+}
+
+func _DependencyRPC_SendDependencies_Handler(srv interface{}, stream grpc.ServerStream) error {
+	return srv.(DependencyRPCServer).SendDependencies(&dependencyRPCSendDependenciesServer{stream})
+}
+
+type DependencyRPC_SendDependenciesServer interface {
+	SendAndClose(*Empty) error
+	Recv() (*Dependency, error)
+	grpc.ServerStream
+}
+
+type dependencyRPCSendDependenciesServer struct {
+	grpc.ServerStream
+}
+
+func (x *dependencyRPCSendDependenciesServer) SendAndClose(m *Empty) error {
+	return x.ServerStream.SendMsg(m)
+}
+
+func (x *dependencyRPCSendDependenciesServer) Recv() (*Dependency, error) {
+	m := new(Dependency)
+	if err := x.ServerStream.RecvMsg(m); err != nil {
+		return nil, err
+	}
+	return m, nil
+}
+
 // DependencyRPC_ServiceDesc is the grpc.ServiceDesc for DependencyRPC service.
 // It's only intended for direct use with grpc.RegisterService,
 // and not to be introspected or modified (even as a copy)
@@ -748,6 +935,22 @@ var DependencyRPC_ServiceDesc = grpc.ServiceDesc{
 			Handler:    _DependencyRPC_SendNeedInput_Handler,
 		},
 	},
-	Streams:  []grpc.StreamDesc{},
+	Streams: []grpc.StreamDesc{
+		{
+			StreamName:    "StreamNewInput",
+			Handler:       _DependencyRPC_StreamNewInput_Handler,
+			ServerStreams: true,
+		},
+		{
+			StreamName:    "StreamCondition",
+			Handler:       _DependencyRPC_StreamCondition_Handler,
+			ServerStreams: true,
+		},
+		{
+			StreamName:    "SendDependencies",
+			Handler:       _DependencyRPC_SendDependencies_Handler,
+			ClientStreams: true,
+		},
+	},
 	Metadata: "DependencyRPC.proto",
 }